@@ -1,774 +1,1714 @@
-/** @file
-
-  Copyright (c) 2008 - 2009, Apple Inc. All rights reserved.<BR>
-
-  This program and the accompanying materials
-  are licensed and made available under the terms and conditions of the BSD License
-  which accompanies this distribution.  The full text of the license may be found at
-  http://opensource.org/licenses/bsd-license.php
-
-  THE PROGRAM IS DISTRIBUTED UNDER THE BSD LICENSE ON AN "AS IS" BASIS,
-  WITHOUT WARRANTIES OR REPRESENTATIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED.
-
-**/
-
-#include "Flash.h"
-
-NAND_PART_INFO_TABLE gNandPartInfoTable[1] = {
-  { 0x2C, 0xBA, 17, 11 }
-};
-
-NAND_FLASH_INFO *gNandFlashInfo = NULL;
-UINT8           *gEccCode;
-UINTN           gNum512BytesChunks = 0;
-
-//
-
-// Device path for SemiHosting. It contains our autogened Caller ID GUID.
-
-//
-
-typedef struct {
-
-  VENDOR_DEVICE_PATH        Guid;
-
-  EFI_DEVICE_PATH_PROTOCOL  End;
-
-} FLASH_DEVICE_PATH;
-
-
-
-FLASH_DEVICE_PATH gDevicePath = {
-  {
-    { HARDWARE_DEVICE_PATH, HW_VENDOR_DP, { sizeof (VENDOR_DEVICE_PATH), 0 } },
-    EFI_CALLER_ID_GUID
-  },
-  { END_DEVICE_PATH_TYPE, END_ENTIRE_DEVICE_PATH_SUBTYPE, { sizeof (EFI_DEVICE_PATH_PROTOCOL), 0} }
-};
-
-
-
-//Actual page address = Column address + Page address + Block address.
-UINTN
-GetActualPageAddressInBytes (
-  UINTN BlockIndex,
-  UINTN PageIndex
-)
-{
-  //BlockAddressStart = Start of the Block address in actual NAND
-  //PageAddressStart = Start of the Page address in actual NAND
-  return ((BlockIndex << gNandFlashInfo->BlockAddressStart) + (PageIndex << gNandFlashInfo->PageAddressStart));
-}
-
-VOID
-NandSendCommand (
-  UINT8 Command
-)
-{
-  MmioWrite16(GPMC_NAND_COMMAND_0, Command);
-}
-
-VOID
-NandSendAddress (
-  UINT8 Address
-)
-{
-  MmioWrite16(GPMC_NAND_ADDRESS_0, Address);
-}
-
-UINT16
-NandReadStatus (
-  VOID
-  )
-{
-  //Send READ STATUS command
-  NandSendCommand(READ_STATUS_CMD);
-
-  //Read status.
-  return MmioRead16(GPMC_NAND_DATA_0);
-}
-
-VOID
-NandSendAddressCycles (
-  UINTN Address
-)
-{
-  //Column address
-  NandSendAddress(Address & 0xff);
-  Address >>= 8;
-
-  //Column address
-  NandSendAddress(Address & 0x07);
-  Address >>= 3;
-
-  //Page and Block address
-  NandSendAddress(Address & 0xff);
-  Address >>= 8;
-
-  //Block address
-  NandSendAddress(Address & 0xff);
-  Address >>= 8;
-
-  //Block address
-  NandSendAddress(Address & 0x01);
-}
-
-VOID
-GpmcInit (
-  VOID
-  )
-{
-  //Enable Smart-idle mode.
-  MmioWrite32 (GPMC_SYSCONFIG, SMARTIDLEMODE);
-
-  //Set IRQSTATUS and IRQENABLE to the reset value
-  MmioWrite32 (GPMC_IRQSTATUS, 0x0);
-  MmioWrite32 (GPMC_IRQENABLE, 0x0);
-
-  //Disable GPMC timeout control.
-  MmioWrite32 (GPMC_TIMEOUT_CONTROL, TIMEOUTDISABLE);
-
-  //Set WRITEPROTECT bit to enable write access.
-  MmioWrite32 (GPMC_CONFIG, WRITEPROTECT_HIGH);
-
-  //NOTE: Following GPMC_CONFIGi_0 register settings are taken from u-boot memory dump.
-  MmioWrite32 (GPMC_CONFIG1_0, DEVICETYPE_NAND | DEVICESIZE_X16);
-  MmioWrite32 (GPMC_CONFIG2_0, CSRDOFFTIME | CSWROFFTIME);
-  MmioWrite32 (GPMC_CONFIG3_0, ADVRDOFFTIME | ADVWROFFTIME);
-  MmioWrite32 (GPMC_CONFIG4_0, OEONTIME | OEOFFTIME | WEONTIME | WEOFFTIME);
-  MmioWrite32 (GPMC_CONFIG5_0, RDCYCLETIME | WRCYCLETIME | RDACCESSTIME | PAGEBURSTACCESSTIME);
-  MmioWrite32 (GPMC_CONFIG6_0, WRACCESSTIME | WRDATAONADMUXBUS | CYCLE2CYCLEDELAY | CYCLE2CYCLESAMECSEN);
-  MmioWrite32 (GPMC_CONFIG7_0, MASKADDRESS_128MB | CSVALID | BASEADDRESS);
-}
-
-EFI_STATUS
-NandDetectPart (
-  VOID
-)
-{
-  UINT8      NandInfo = 0;
-  UINT8      PartInfo[5];
-  UINTN      Index;
-  BOOLEAN    Found = FALSE;
-
-  //Send READ ID command
-  NandSendCommand(READ_ID_CMD);
-
-  //Send one address cycle.
-  NandSendAddress(0);
-
-  //Read 5-bytes to idenfity code programmed into the NAND flash devices.
-  //BYTE 0 = Manufacture ID
-  //Byte 1 = Device ID
-  //Byte 2, 3, 4 = Nand part specific information (Page size, Block size etc)
-  for (Index = 0; Index < sizeof(PartInfo); Index++) {
-    PartInfo[Index] = MmioRead16(GPMC_NAND_DATA_0);
-  }
-
-  //Check if the ManufactureId and DeviceId are part of the currently supported nand parts.
-  for (Index = 0; Index < sizeof(gNandPartInfoTable)/sizeof(NAND_PART_INFO_TABLE); Index++) {
-    if (gNandPartInfoTable[Index].ManufactureId == PartInfo[0] && gNandPartInfoTable[Index].DeviceId == PartInfo[1]) {
-      gNandFlashInfo->BlockAddressStart = gNandPartInfoTable[Index].BlockAddressStart;
-      gNandFlashInfo->PageAddressStart = gNandPartInfoTable[Index].PageAddressStart;
-      Found = TRUE;
-      break;
-    }
-  }
-
-  if (Found == FALSE) {
-    DEBUG ((EFI_D_ERROR, "Nand part is not currently supported. Manufacture id: %x, Device id: %x\n", PartInfo[0], PartInfo[1]));
-    return EFI_NOT_FOUND;
-  }
-
-  //Populate NAND_FLASH_INFO based on the result of READ ID command.
-  gNandFlashInfo->ManufactureId = PartInfo[0];
-  gNandFlashInfo->DeviceId = PartInfo[1];
-  NandInfo = PartInfo[3];
-
-  if (PAGE_SIZE(NandInfo) == PAGE_SIZE_2K_VAL) {
-    gNandFlashInfo->PageSize = PAGE_SIZE_2K;
-  } else {
-    DEBUG ((EFI_D_ERROR, "Unknown Page size.\n"));
-    return EFI_DEVICE_ERROR;
-  }
-
-  if (SPARE_AREA_SIZE(NandInfo) == SPARE_AREA_SIZE_64B_VAL) {
-    gNandFlashInfo->SparePageSize = SPARE_AREA_SIZE_64B;
-  } else {
-    DEBUG ((EFI_D_ERROR, "Unknown Spare area size.\n"));
-    return EFI_DEVICE_ERROR;
-  }
-
-  if (BLOCK_SIZE(NandInfo) == BLOCK_SIZE_128K_VAL) {
-    gNandFlashInfo->BlockSize = BLOCK_SIZE_128K;
-  } else {
-    DEBUG ((EFI_D_ERROR, "Unknown Block size.\n"));
-    return EFI_DEVICE_ERROR;
-  }
-
-  if (ORGANIZATION(NandInfo) == ORGANIZATION_X8) {
-    gNandFlashInfo->Organization = 0;
-  } else if (ORGANIZATION(NandInfo) == ORGANIZATION_X16) {
-    gNandFlashInfo->Organization = 1;
-  }
-
-  //Calculate total number of blocks.
-  gNandFlashInfo->NumPagesPerBlock = DivU64x32(gNandFlashInfo->BlockSize, gNandFlashInfo->PageSize);
-
-  return EFI_SUCCESS;
-}
-
-VOID
-NandConfigureEcc (
-  VOID
-  )
-{
-  //Define ECC size 0 and size 1 to 512 bytes
-  MmioWrite32 (GPMC_ECC_SIZE_CONFIG, (ECCSIZE0_512BYTES | ECCSIZE1_512BYTES));
-}
-
-VOID
-NandEnableEcc (
-  VOID
-  )
-{
-  //Clear all the ECC result registers and select ECC result register 1
-  MmioWrite32 (GPMC_ECC_CONTROL, (ECCCLEAR | ECCPOINTER_REG1));
-
-  //Enable ECC engine on CS0
-  MmioWrite32 (GPMC_ECC_CONFIG, (ECCENABLE | ECCCS_0 | ECC16B));
-}
-
-VOID
-NandDisableEcc (
-  VOID
-  )
-{
-  //Turn off ECC engine.
-  MmioWrite32 (GPMC_ECC_CONFIG, ECCDISABLE);
-}
-
-VOID
-NandCalculateEcc (
-  VOID
-  )
-{
-  UINTN Index;
-  UINTN EccResultRegister;
-  UINTN EccResult;
-
-  //Capture 32-bit ECC result for each 512-bytes chunk.
-  //In our case PageSize is 2K so read ECC1-ECC4 result registers and
-  //generate total of 12-bytes of ECC code for the particular page.
-
-  EccResultRegister = GPMC_ECC1_RESULT;
-
-  for (Index = 0; Index < gNum512BytesChunks; Index++) {
-
-    EccResult = MmioRead32 (EccResultRegister);
-
-    //Calculate ECC code from 32-bit ECC result value.
-    //NOTE: Following calculation is not part of TRM. We got this information
-    //from Beagleboard mailing list.
-    gEccCode[Index * 3] = EccResult & 0xFF;
-    gEccCode[(Index * 3) + 1] = (EccResult >> 16) & 0xFF;
-    gEccCode[(Index * 3) + 2] = (((EccResult >> 20) & 0xF0) | ((EccResult >> 8) & 0x0F));
-
-    //Point to next ECC result register.
-    EccResultRegister += 4;
-  }
-}
-
-EFI_STATUS
-NandReadPage (
-  IN  UINTN                         BlockIndex,
-  IN  UINTN                         PageIndex,
-  OUT VOID                          *Buffer,
-  OUT UINT8                         *SpareBuffer
-)
-{
-  UINTN      Address;
-  UINTN      Index;
-  UINTN      NumMainAreaWords = (gNandFlashInfo->PageSize/2);
-  UINTN      NumSpareAreaWords = (gNandFlashInfo->SparePageSize/2);
-  UINT16     *MainAreaWordBuffer = Buffer;
-  UINT16     *SpareAreaWordBuffer = (UINT16 *)SpareBuffer;
-  UINTN      Timeout = MAX_RETRY_COUNT;
-
-  //Generate device address in bytes to access specific block and page index
-  Address = GetActualPageAddressInBytes(BlockIndex, PageIndex);
-
-  //Send READ command
-  NandSendCommand(PAGE_READ_CMD);
-
-  //Send 5 Address cycles to access specific device address
-  NandSendAddressCycles(Address);
-
-  //Send READ CONFIRM command
-  NandSendCommand(PAGE_READ_CONFIRM_CMD);
-
-  //Poll till device is busy.
-  while (Timeout) {
-    if ((NandReadStatus() & NAND_READY) == NAND_READY) {
-      break;
-    }
-    Timeout--;
-  }
-
-  if (Timeout == 0) {
-    DEBUG ((EFI_D_ERROR, "Read page timed out.\n"));
-    return EFI_TIMEOUT;
-  }
-
-  //Reissue READ command
-  NandSendCommand(PAGE_READ_CMD);
-
-  //Enable ECC engine.
-  NandEnableEcc();
-
-  //Read data into the buffer.
-  for (Index = 0; Index < NumMainAreaWords; Index++) {
-    *MainAreaWordBuffer++ = MmioRead16(GPMC_NAND_DATA_0);
-  }
-
-  //Read spare area into the buffer.
-  for (Index = 0; Index < NumSpareAreaWords; Index++) {
-    *SpareAreaWordBuffer++ = MmioRead16(GPMC_NAND_DATA_0);
-  }
-
-  //Calculate ECC.
-  NandCalculateEcc();
-
-  //Turn off ECC engine.
-  NandDisableEcc();
-
-  //Perform ECC correction.
-  //Need to implement..
-
-  return EFI_SUCCESS;
-}
-
-EFI_STATUS
-NandWritePage (
-  IN  UINTN                         BlockIndex,
-  IN  UINTN                         PageIndex,
-  OUT VOID                          *Buffer,
-  IN  UINT8                         *SpareBuffer
-)
-{
-  UINTN      Address;
-  UINT16     *MainAreaWordBuffer = Buffer;
-  UINT16     *SpareAreaWordBuffer = (UINT16 *)SpareBuffer;
-  UINTN      Index;
-  UINTN      NandStatus;
-  UINTN      Timeout = MAX_RETRY_COUNT;
-
-  //Generate device address in bytes to access specific block and page index
-  Address = GetActualPageAddressInBytes(BlockIndex, PageIndex);
-
-  //Send SERIAL DATA INPUT command
-  NandSendCommand(PROGRAM_PAGE_CMD);
-
-  //Send 5 Address cycles to access specific device address
-  NandSendAddressCycles(Address);
-
-  //Enable ECC engine.
-  NandEnableEcc();
-
-  //Data input from Buffer
-  for (Index = 0; Index < (gNandFlashInfo->PageSize/2); Index++) {
-    MmioWrite16(GPMC_NAND_DATA_0, *MainAreaWordBuffer++);
-
-    //After each write access, device has to wait to accept data.
-    //Currently we may not be programming proper timing parameters to
-    //the GPMC_CONFIGi_0 registers and we would need to figure that out.
-    //Without following delay, page programming fails.
-    gBS->Stall(1);
-  }
-
-  //Calculate ECC.
-  NandCalculateEcc();
-
-  //Turn off ECC engine.
-  NandDisableEcc();
-
-  //Prepare Spare area buffer with ECC codes.
-  SetMem(SpareBuffer, gNandFlashInfo->SparePageSize, 0xFF);
-  CopyMem(&SpareBuffer[ECC_POSITION], gEccCode, gNum512BytesChunks * 3);
-
-  //Program spare area with calculated ECC.
-  for (Index = 0; Index < (gNandFlashInfo->SparePageSize/2); Index++) {
-    MmioWrite16(GPMC_NAND_DATA_0, *SpareAreaWordBuffer++);
-  }
-
-  //Send PROGRAM command
-  NandSendCommand(PROGRAM_PAGE_CONFIRM_CMD);
-
-  //Poll till device is busy.
-  NandStatus = 0;
-  while (Timeout) {
-    NandStatus = NandReadStatus();
-    if ((NandStatus & NAND_READY) == NAND_READY) {
-      break;
-    }
-    Timeout--;
-  }
-
-  if (Timeout == 0) {
-    DEBUG ((EFI_D_ERROR, "Program page timed out.\n"));
-    return EFI_TIMEOUT;
-  }
-
-  //Bit0 indicates Pass/Fail status
-  if (NandStatus & NAND_FAILURE) {
-    return EFI_DEVICE_ERROR;
-  }
-
-  return EFI_SUCCESS;
-}
-
-EFI_STATUS
-NandEraseBlock (
-  IN UINTN BlockIndex
-)
-{
-  UINTN      Address;
-  UINTN      NandStatus;
-  UINTN      Timeout = MAX_RETRY_COUNT;
-
-  //Generate device address in bytes to access specific block and page index
-  Address = GetActualPageAddressInBytes(BlockIndex, 0);
-
-  //Send ERASE SETUP command
-  NandSendCommand(BLOCK_ERASE_CMD);
-
-  //Send 3 address cycles to device to access Page address and Block address
-  Address >>= 11; //Ignore column addresses
-
-  NandSendAddress(Address & 0xff);
-  Address >>= 8;
-
-  NandSendAddress(Address & 0xff);
-  Address >>= 8;
-
-  NandSendAddress(Address & 0xff);
-
-  //Send ERASE CONFIRM command
-  NandSendCommand(BLOCK_ERASE_CONFIRM_CMD);
-
-  //Poll till device is busy.
-  NandStatus = 0;
-  while (Timeout) {
-    NandStatus = NandReadStatus();
-    if ((NandStatus & NAND_READY) == NAND_READY) {
-      break;
-    }
-    Timeout--;
-    gBS->Stall(1);
-  }
-
-  if (Timeout == 0) {
-    DEBUG ((EFI_D_ERROR, "Erase block timed out for Block: %d.\n", BlockIndex));
-    return EFI_TIMEOUT;
-  }
-
-  //Bit0 indicates Pass/Fail status
-  if (NandStatus & NAND_FAILURE) {
-    return EFI_DEVICE_ERROR;
-  }
-
-  return EFI_SUCCESS;
-}
-
-EFI_STATUS
-NandReadBlock (
-  IN UINTN                          StartBlockIndex,
-  IN UINTN                          EndBlockIndex,
-  OUT VOID                          *Buffer,
-  OUT VOID                          *SpareBuffer
-)
-{
-  UINTN      BlockIndex;
-  UINTN      PageIndex;
-  EFI_STATUS Status = EFI_SUCCESS;
-
-  for (BlockIndex = StartBlockIndex; BlockIndex <= EndBlockIndex; BlockIndex++) {
-    //For each block read number of pages
-    for (PageIndex = 0; PageIndex < gNandFlashInfo->NumPagesPerBlock; PageIndex++) {
-      Status = NandReadPage(BlockIndex, PageIndex, Buffer, SpareBuffer);
-      if (EFI_ERROR(Status)) {
-        return Status;
-      }
-      Buffer = ((UINT8 *)Buffer + gNandFlashInfo->PageSize);
-    }
-  }
-
-  return Status;
-}
-
-EFI_STATUS
-NandWriteBlock (
-  IN UINTN                          StartBlockIndex,
-  IN UINTN                          EndBlockIndex,
-  OUT VOID                          *Buffer,
-  OUT VOID                          *SpareBuffer
-  )
-{
-  UINTN      BlockIndex;
-  UINTN      PageIndex;
-  EFI_STATUS Status = EFI_SUCCESS;
-
-  for (BlockIndex = StartBlockIndex; BlockIndex <= EndBlockIndex; BlockIndex++) {
-    //Page programming.
-    for (PageIndex = 0; PageIndex < gNandFlashInfo->NumPagesPerBlock; PageIndex++) {
-      Status = NandWritePage(BlockIndex, PageIndex, Buffer, SpareBuffer);
-      if (EFI_ERROR(Status)) {
-        return Status;
-      }
-      Buffer = ((UINT8 *)Buffer + gNandFlashInfo->PageSize);
-    }
-  }
-
-  return Status;
-}
-
-EFI_STATUS
-EFIAPI
-NandFlashReset (
-  IN EFI_BLOCK_IO_PROTOCOL          *This,
-  IN BOOLEAN                        ExtendedVerification
-  )
-{
-  UINTN BusyStall = 50;                            // microSeconds
-  UINTN ResetBusyTimeout = (1000000 / BusyStall);  // 1 Second
-
-  //Send RESET command to device.
-  NandSendCommand(RESET_CMD);
-
-  //Wait for 1ms before we check status register.
-  gBS->Stall(1000);
-
-  //Check BIT#5 & BIT#6 in Status register to make sure RESET is done.
-  while ((NandReadStatus() & NAND_RESET_STATUS) != NAND_RESET_STATUS) {
-
-    //In case of extended verification, wait for extended amount of time
-    //to make sure device is reset.
-    if (ExtendedVerification) {
-      if (ResetBusyTimeout == 0) {
-        return EFI_DEVICE_ERROR;
-      }
-
-      gBS->Stall(BusyStall);
-      ResetBusyTimeout--;
-    }
-  }
-
-  return EFI_SUCCESS;
-}
-
-EFI_STATUS
-EFIAPI
-NandFlashReadBlocks (
-  IN EFI_BLOCK_IO_PROTOCOL          *This,
-  IN UINT32                         MediaId,
-  IN EFI_LBA                        Lba,
-  IN UINTN                          BufferSize,
-  OUT VOID                          *Buffer
-  )
-{
-  UINTN      NumBlocks;
-  UINTN      EndBlockIndex;
-  EFI_STATUS Status;
-  UINT8      *SpareBuffer = NULL;
-
-  if (Buffer == NULL) {
-    Status = EFI_INVALID_PARAMETER;
-    goto exit;
-  }
-
-  if (Lba > LAST_BLOCK) {
-    Status = EFI_INVALID_PARAMETER;
-    goto exit;
-  }
-
-  if ((BufferSize % gNandFlashInfo->BlockSize) != 0) {
-    Status = EFI_BAD_BUFFER_SIZE;
-    goto exit;
-  }
-
-  NumBlocks = DivU64x32(BufferSize, gNandFlashInfo->BlockSize);
-  EndBlockIndex = ((UINTN)Lba + NumBlocks) - 1;
-
-  SpareBuffer = (UINT8 *)AllocatePool(gNandFlashInfo->SparePageSize);
-  if (SpareBuffer == NULL) {
-    Status = EFI_OUT_OF_RESOURCES;
-    goto exit;
-  }
-
-  //Read block
-  Status = NandReadBlock((UINTN)Lba, EndBlockIndex, Buffer, SpareBuffer);
-  if (EFI_ERROR(Status)) {
-    DEBUG((EFI_D_ERROR, "Read block fails: %x\n", Status));
-    goto exit;
-  }
-
-exit:
-  if (SpareBuffer != NULL) {
-    FreePool (SpareBuffer);
-  }
-
-  return Status;
-}
-
-EFI_STATUS
-EFIAPI
-NandFlashWriteBlocks (
-  IN EFI_BLOCK_IO_PROTOCOL          *This,
-  IN UINT32                         MediaId,
-  IN EFI_LBA                        Lba,
-  IN UINTN                          BufferSize,
-  IN VOID                           *Buffer
-  )
-{
-  UINTN      BlockIndex;
-  UINTN      NumBlocks;
-  UINTN      EndBlockIndex;
-  EFI_STATUS Status;
-  UINT8      *SpareBuffer = NULL;
-
-  if (Buffer == NULL) {
-    Status = EFI_INVALID_PARAMETER;
-    goto exit;
-  }
-
-  if (Lba > LAST_BLOCK) {
-    Status = EFI_INVALID_PARAMETER;
-    goto exit;
-  }
-
-  if ((BufferSize % gNandFlashInfo->BlockSize) != 0) {
-    Status = EFI_BAD_BUFFER_SIZE;
-    goto exit;
-  }
-
-  NumBlocks = DivU64x32(BufferSize, gNandFlashInfo->BlockSize);
-  EndBlockIndex = ((UINTN)Lba + NumBlocks) - 1;
-
-  SpareBuffer = (UINT8 *)AllocatePool(gNandFlashInfo->SparePageSize);
-  if (SpareBuffer == NULL) {
-    Status = EFI_OUT_OF_RESOURCES;
-    goto exit;
-  }
-
-  // Erase block
-  for (BlockIndex = (UINTN)Lba; BlockIndex <= EndBlockIndex; BlockIndex++) {
-    Status = NandEraseBlock(BlockIndex);
-    if (EFI_ERROR(Status)) {
-      DEBUG((EFI_D_ERROR, "Erase block failed. Status: %x\n", Status));
-      goto exit;
-    }
-  }
-
-  // Program data
-  Status = NandWriteBlock((UINTN)Lba, EndBlockIndex, Buffer, SpareBuffer);
-  if (EFI_ERROR(Status)) {
-    DEBUG((EFI_D_ERROR, "Block write fails: %x\n", Status));
-    goto exit;
-  }
-
-exit:
-  if (SpareBuffer != NULL) {
-    FreePool (SpareBuffer);
-  }
-
-  return Status;
-}
-
-EFI_STATUS
-EFIAPI
-NandFlashFlushBlocks (
-  IN EFI_BLOCK_IO_PROTOCOL  *This
-  )
-{
-  return EFI_SUCCESS;
-}
-
-
-
-EFI_BLOCK_IO_MEDIA gNandFlashMedia = {
-  SIGNATURE_32('n','a','n','d'),            // MediaId
-  FALSE,                                    // RemovableMedia
-  TRUE,                                     // MediaPresent
-  FALSE,                                    // LogicalPartition
-  FALSE,                                    // ReadOnly
-  FALSE,                                    // WriteCaching
-  0,                                        // BlockSize
-  2,                                        // IoAlign
-  0,                                        // Pad
-  0                                         // LastBlock
-};
-
-EFI_BLOCK_IO_PROTOCOL BlockIo =
-{
-  EFI_BLOCK_IO_INTERFACE_REVISION,  // Revision
-  &gNandFlashMedia,                  // *Media
-  NandFlashReset,                   // Reset
-  NandFlashReadBlocks,              // ReadBlocks
-  NandFlashWriteBlocks,             // WriteBlocks
-  NandFlashFlushBlocks              // FlushBlocks
-};
-
-EFI_STATUS
-NandFlashInitialize (
-  IN EFI_HANDLE         ImageHandle,
-  IN EFI_SYSTEM_TABLE   *SystemTable
-  )
-{
-  EFI_STATUS  Status;
-
-  gNandFlashInfo = (NAND_FLASH_INFO *)AllocateZeroPool (sizeof(NAND_FLASH_INFO));
-
-  //Initialize GPMC module.
-  GpmcInit();
-
-  //Reset NAND part
-  NandFlashReset(&BlockIo, FALSE);
-
-  //Detect NAND part and populate gNandFlashInfo structure
-  Status = NandDetectPart ();
-  if (EFI_ERROR(Status)) {
-    DEBUG((EFI_D_ERROR, "Nand part id detection failure: Status: %x\n", Status));
-    return Status;
-  }
-
-  //Count total number of 512Bytes chunk based on the page size.
-  if (gNandFlashInfo->PageSize == PAGE_SIZE_512B) {
-    gNum512BytesChunks = 1;
-  } else if (gNandFlashInfo->PageSize == PAGE_SIZE_2K) {
-    gNum512BytesChunks = 4;
-  } else if (gNandFlashInfo->PageSize == PAGE_SIZE_4K) {
-    gNum512BytesChunks = 8;
-  }
-
-  gEccCode = (UINT8 *)AllocatePool(gNum512BytesChunks * 3);
-  if (gEccCode == NULL) {
-    return EFI_OUT_OF_RESOURCES;
-  }
-
-  //Configure ECC
-  NandConfigureEcc ();
-
-  //Patch EFI_BLOCK_IO_MEDIA structure.
-  gNandFlashMedia.BlockSize = gNandFlashInfo->BlockSize;
-  gNandFlashMedia.LastBlock = LAST_BLOCK;
-
-  //Publish BlockIO.
-  Status = gBS->InstallMultipleProtocolInterfaces (
-                  &ImageHandle,
-                  &gEfiBlockIoProtocolGuid, &BlockIo,
-                  &gEfiDevicePathProtocolGuid, &gDevicePath,
-                  NULL
-                  );
-  return Status;
-}
-
+/** @file
+
+  Copyright (c) 2008 - 2009, Apple Inc. All rights reserved.<BR>
+
+  This program and the accompanying materials
+  are licensed and made available under the terms and conditions of the BSD License
+  which accompanies this distribution.  The full text of the license may be found at
+  http://opensource.org/licenses/bsd-license.php
+
+  THE PROGRAM IS DISTRIBUTED UNDER THE BSD LICENSE ON AN "AS IS" BASIS,
+  WITHOUT WARRANTIES OR REPRESENTATIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED.
+
+**/
+
+#include "Flash.h"
+
+//Parts without a parameter page. NAND_FEATURE_READ_CACHE is only listed for
+//parts whose datasheet documents the 31h/3Fh cache read sequence.
+NAND_PART_INFO_TABLE gNandPartInfoTable[1] = {
+  { 0x2C, 0xBA, 17, 11, 0, 2048 }
+};
+
+NAND_FLASH_INFO *gNandFlashInfo = NULL;
+UINT8           *gEccCode;
+UINTN           gNum512BytesChunks = 0;
+
+//Number of set bits for each byte value, used to weigh ECC syndromes.
+UINT8               gEccBitCount[256];
+NAND_ECC_STATISTICS gNandEccStatistics;
+
+//Set by the GPMC interrupt handler on a WAIT0 (ready) edge.
+volatile BOOLEAN    gNandReady = FALSE;
+
+//
+
+// Device path for SemiHosting. It contains our autogened Caller ID GUID.
+
+//
+
+typedef struct {
+
+  VENDOR_DEVICE_PATH        Guid;
+
+  EFI_DEVICE_PATH_PROTOCOL  End;
+
+} FLASH_DEVICE_PATH;
+
+
+
+FLASH_DEVICE_PATH gDevicePath = {
+  {
+    { HARDWARE_DEVICE_PATH, HW_VENDOR_DP, { sizeof (VENDOR_DEVICE_PATH), 0 } },
+    EFI_CALLER_ID_GUID
+  },
+  { END_DEVICE_PATH_TYPE, END_ENTIRE_DEVICE_PATH_SUBTYPE, { sizeof (EFI_DEVICE_PATH_PROTOCOL), 0} }
+};
+
+
+
+//Actual page address = Column address + Page address + Block address.
+UINTN
+GetActualPageAddressInBytes (
+  UINTN BlockIndex,
+  UINTN PageIndex
+)
+{
+  //BlockAddressStart = Start of the Block address in actual NAND
+  //PageAddressStart = Start of the Page address in actual NAND
+  return ((BlockIndex << gNandFlashInfo->BlockAddressStart) + (PageIndex << gNandFlashInfo->PageAddressStart));
+}
+
+VOID
+NandSendCommand (
+  UINT8 Command
+)
+{
+  MmioWrite16(GPMC_NAND_COMMAND_0, Command);
+}
+
+VOID
+NandSendAddress (
+  UINT8 Address
+)
+{
+  MmioWrite16(GPMC_NAND_ADDRESS_0, Address);
+}
+
+UINT16
+NandReadStatus (
+  VOID
+  )
+{
+  //Send READ STATUS command
+  NandSendCommand(READ_STATUS_CMD);
+
+  //Read status.
+  return MmioRead16(GPMC_NAND_DATA_0);
+}
+
+VOID
+NandSendRowAddressCycles (
+  UINTN Row
+)
+{
+  UINTN Index;
+
+  //Page and Block address
+  for (Index = 0; Index < gNandFlashInfo->RowAddressCycles; Index++) {
+    NandSendAddress(Row & 0xff);
+    Row >>= 8;
+  }
+}
+
+VOID
+NandSendAddressCycles (
+  UINTN Address
+)
+{
+  UINTN Column;
+  UINTN Index;
+
+  Column = Address & ((1 << gNandFlashInfo->PageAddressStart) - 1);
+
+  //Column address
+  for (Index = 0; Index < gNandFlashInfo->ColumnAddressCycles; Index++) {
+    NandSendAddress(Column & 0xff);
+    Column >>= 8;
+  }
+
+  NandSendRowAddressCycles(Address >> gNandFlashInfo->PageAddressStart);
+}
+
+VOID
+GpmcInit (
+  VOID
+  )
+{
+  //Enable Smart-idle mode.
+  MmioWrite32 (GPMC_SYSCONFIG, SMARTIDLEMODE);
+
+  //Set IRQSTATUS and IRQENABLE to the reset value
+  MmioWrite32 (GPMC_IRQSTATUS, 0x0);
+  MmioWrite32 (GPMC_IRQENABLE, 0x0);
+
+  //Disable GPMC timeout control.
+  MmioWrite32 (GPMC_TIMEOUT_CONTROL, TIMEOUTDISABLE);
+
+  //Set WRITEPROTECT bit to enable write access. The NAND R/B# output drives
+  //WAIT0 and is high when the part is ready.
+  MmioWrite32 (GPMC_CONFIG, WRITEPROTECT_HIGH | WAIT0PINPOLARITY_HIGH);
+
+  //NOTE: Following GPMC_CONFIGi_0 register settings are taken from u-boot memory dump.
+  MmioWrite32 (GPMC_CONFIG1_0, DEVICETYPE_NAND | DEVICESIZE_X16);
+  MmioWrite32 (GPMC_CONFIG2_0, CSRDOFFTIME | CSWROFFTIME);
+  MmioWrite32 (GPMC_CONFIG3_0, ADVRDOFFTIME | ADVWROFFTIME);
+  MmioWrite32 (GPMC_CONFIG4_0, OEONTIME | OEOFFTIME | WEONTIME | WEOFFTIME);
+  MmioWrite32 (GPMC_CONFIG5_0, RDCYCLETIME | WRCYCLETIME | RDACCESSTIME | PAGEBURSTACCESSTIME);
+  MmioWrite32 (GPMC_CONFIG6_0, WRACCESSTIME | WRDATAONADMUXBUS | CYCLE2CYCLEDELAY | CYCLE2CYCLESAMECSEN);
+  MmioWrite32 (GPMC_CONFIG7_0, MASKADDRESS_128MB | CSVALID | BASEADDRESS);
+}
+
+//Decode the geometry of parts without a parameter page from the READ ID bytes.
+EFI_STATUS
+NandDetectPartFromTable (
+  IN UINT8  *PartInfo
+  )
+{
+  UINT8      NandInfo = 0;
+  UINTN      Index;
+  BOOLEAN    Found = FALSE;
+
+  //Check if the ManufactureId and DeviceId are part of the currently supported nand parts.
+  for (Index = 0; Index < sizeof(gNandPartInfoTable)/sizeof(NAND_PART_INFO_TABLE); Index++) {
+    if (gNandPartInfoTable[Index].ManufactureId == PartInfo[0] && gNandPartInfoTable[Index].DeviceId == PartInfo[1]) {
+      gNandFlashInfo->BlockAddressStart = gNandPartInfoTable[Index].BlockAddressStart;
+      gNandFlashInfo->PageAddressStart = gNandPartInfoTable[Index].PageAddressStart;
+      gNandFlashInfo->ReadCache = (gNandPartInfoTable[Index].Features & NAND_FEATURE_READ_CACHE) != 0;
+      gNandFlashInfo->BlockCount = gNandPartInfoTable[Index].BlockCount;
+      Found = TRUE;
+      break;
+    }
+  }
+
+  if (Found == FALSE) {
+    DEBUG ((EFI_D_ERROR, "Nand part is not currently supported. Manufacture id: %x, Device id: %x\n", PartInfo[0], PartInfo[1]));
+    return EFI_NOT_FOUND;
+  }
+
+  //Populate NAND_FLASH_INFO based on the result of READ ID command.
+  NandInfo = PartInfo[3];
+
+  if (PAGE_SIZE(NandInfo) == PAGE_SIZE_2K_VAL) {
+    gNandFlashInfo->PageSize = PAGE_SIZE_2K;
+  } else {
+    DEBUG ((EFI_D_ERROR, "Unknown Page size.\n"));
+    return EFI_DEVICE_ERROR;
+  }
+
+  if (SPARE_AREA_SIZE(NandInfo) == SPARE_AREA_SIZE_64B_VAL) {
+    gNandFlashInfo->SparePageSize = SPARE_AREA_SIZE_64B;
+  } else {
+    DEBUG ((EFI_D_ERROR, "Unknown Spare area size.\n"));
+    return EFI_DEVICE_ERROR;
+  }
+
+  if (BLOCK_SIZE(NandInfo) == BLOCK_SIZE_128K_VAL) {
+    gNandFlashInfo->BlockSize = BLOCK_SIZE_128K;
+  } else {
+    DEBUG ((EFI_D_ERROR, "Unknown Block size.\n"));
+    return EFI_DEVICE_ERROR;
+  }
+
+  if (ORGANIZATION(NandInfo) == ORGANIZATION_X8) {
+    gNandFlashInfo->Organization = 0;
+  } else if (ORGANIZATION(NandInfo) == ORGANIZATION_X16) {
+    gNandFlashInfo->Organization = 1;
+  }
+
+  //Calculate total number of blocks.
+  gNandFlashInfo->NumPagesPerBlock = DivU64x32(gNandFlashInfo->BlockSize, gNandFlashInfo->PageSize);
+
+  gNandFlashInfo->ColumnAddressCycles = 2;
+  gNandFlashInfo->RowAddressCycles = 3;
+  gNandFlashInfo->PlaneCount = 1;
+
+  return EFI_SUCCESS;
+}
+
+EFI_STATUS
+NandDetectPart (
+  VOID
+)
+{
+  UINT8      PartInfo[5];
+  UINTN      Index;
+  EFI_STATUS Status;
+
+  //Send READ ID command
+  NandSendCommand(READ_ID_CMD);
+
+  //Send one address cycle.
+  NandSendAddress(0);
+
+  //Read 5-bytes to idenfity code programmed into the NAND flash devices.
+  //BYTE 0 = Manufacture ID
+  //Byte 1 = Device ID
+  //Byte 2, 3, 4 = Nand part specific information (Page size, Block size etc)
+  for (Index = 0; Index < sizeof(PartInfo); Index++) {
+    PartInfo[Index] = MmioRead16(GPMC_NAND_DATA_0);
+  }
+
+  gNandFlashInfo->ManufactureId = PartInfo[0];
+  gNandFlashInfo->DeviceId = PartInfo[1];
+
+  //ONFI parts describe their own geometry, others have to be in the part table.
+  Status = NandOnfiDetect();
+  if (Status == EFI_NOT_FOUND) {
+    Status = NandDetectPartFromTable(PartInfo);
+  }
+
+  if (EFI_ERROR(Status)) {
+    return Status;
+  }
+
+  //Column addresses count words on x16 parts and cover the spare area.
+  if (gNandFlashInfo->PageAddressStart == 0) {
+    if (gNandFlashInfo->Organization == ORGANIZATION_X16) {
+      gNandFlashInfo->PageAddressStart = (UINT8)(HighBitSet32(gNandFlashInfo->PageSize / 2) + 1);
+    } else {
+      gNandFlashInfo->PageAddressStart = (UINT8)(HighBitSet32(gNandFlashInfo->PageSize) + 1);
+    }
+    gNandFlashInfo->BlockAddressStart = (UINT8)(gNandFlashInfo->PageAddressStart + HighBitSet32(gNandFlashInfo->NumPagesPerBlock));
+  }
+
+  //Pages have to be covered by the ECC result registers, the bad block
+  //table has to fit one page and addresses have to fit a UINTN.
+  if ((gNandFlashInfo->PageSize < PAGE_SIZE_2K) ||
+      (gNandFlashInfo->PageSize % PAGE_SIZE_512B) != 0 ||
+      (gNandFlashInfo->PageSize / PAGE_SIZE_512B) > NAND_MAX_ECC_CHUNKS ||
+      (gNandFlashInfo->SparePageSize < ECC_POSITION + ((gNandFlashInfo->PageSize / PAGE_SIZE_512B) * 3)) ||
+      (gNandFlashInfo->NumPagesPerBlock == 0) ||
+      (gNandFlashInfo->NumPagesPerBlock & (gNandFlashInfo->NumPagesPerBlock - 1)) != 0 ||
+      (gNandFlashInfo->BlockCount > NAND_MAX_BLOCK_COUNT) ||
+      (FeaturePcdGet(PcdOmap35xxNandBbt) && (gNandFlashInfo->BlockCount <= NAND_BBT_BLOCKS + NAND_BBT_RESERVED_BLOCKS)) ||
+      (gNandFlashInfo->BlockAddressStart + HighBitSet32(gNandFlashInfo->BlockCount - 1) + 1 > sizeof(UINTN) * 8)) {
+    DEBUG ((EFI_D_ERROR, "Nand geometry is not supported. Page size: %d, Spare size: %d, Block count: %d\n",
+            gNandFlashInfo->PageSize, gNandFlashInfo->SparePageSize, gNandFlashInfo->BlockCount));
+    return EFI_UNSUPPORTED;
+  }
+
+  //GpmcInit() assumes a x16 part.
+  if (gNandFlashInfo->Organization == ORGANIZATION_X8) {
+    MmioAnd32 (GPMC_CONFIG1_0, ~DEVICESIZE_X16);
+  }
+
+  return EFI_SUCCESS;
+}
+
+VOID
+NandConfigureEcc (
+  VOID
+  )
+{
+  //Define ECC size 0 and size 1 to 512 bytes
+  MmioWrite32 (GPMC_ECC_SIZE_CONFIG, (ECCSIZE0_512BYTES | ECCSIZE1_512BYTES));
+}
+
+VOID
+NandEnableEcc (
+  VOID
+  )
+{
+  //Clear all the ECC result registers and select ECC result register 1
+  MmioWrite32 (GPMC_ECC_CONTROL, (ECCCLEAR | ECCPOINTER_REG1));
+
+  //Enable ECC engine on CS0
+  if (gNandFlashInfo->Organization == ORGANIZATION_X16) {
+    MmioWrite32 (GPMC_ECC_CONFIG, (ECCENABLE | ECCCS_0 | ECC16B));
+  } else {
+    MmioWrite32 (GPMC_ECC_CONFIG, (ECCENABLE | ECCCS_0));
+  }
+}
+
+VOID
+NandDisableEcc (
+  VOID
+  )
+{
+  //Turn off ECC engine.
+  MmioWrite32 (GPMC_ECC_CONFIG, ECCDISABLE);
+}
+
+VOID
+NandCalculateEcc (
+  VOID
+  )
+{
+  UINTN Index;
+  UINTN EccResultRegister;
+  UINTN EccResult;
+
+  //Capture 32-bit ECC result for each 512-bytes chunk. The engine moves to
+  //the next result register after each chunk, so a page uses ECC1 up to
+  //ECCn, n = gNum512BytesChunks, and gets 3-bytes of ECC code per chunk.
+
+  EccResultRegister = GPMC_ECC1_RESULT;
+
+  for (Index = 0; Index < gNum512BytesChunks; Index++) {
+
+    EccResult = MmioRead32 (EccResultRegister);
+
+    //Calculate ECC code from 32-bit ECC result value.
+    //NOTE: Following calculation is not part of TRM. We got this information
+    //from Beagleboard mailing list.
+    gEccCode[Index * 3] = EccResult & 0xFF;
+    gEccCode[(Index * 3) + 1] = (EccResult >> 16) & 0xFF;
+    gEccCode[(Index * 3) + 2] = (((EccResult >> 20) & 0xF0) | ((EccResult >> 8) & 0x0F));
+
+    //Point to next ECC result register.
+    EccResultRegister += 4;
+  }
+}
+
+VOID
+NandInitializeEccTables (
+  VOID
+  )
+{
+  UINTN Index;
+
+  gEccBitCount[0] = 0;
+  for (Index = 1; Index < sizeof(gEccBitCount); Index++) {
+    gEccBitCount[Index] = (UINT8)((Index & 0x01) + gEccBitCount[Index >> 1]);
+  }
+}
+
+//Compare the calculated ECC (gEccCode) against the ECC stored in the spare
+//area and fix single-bit errors in each 512-bytes chunk of the page.
+//
+//The 12 odd parity bits of a chunk cover the bits whose address has the
+//corresponding bit set, the 12 even parity bits cover the others. A single
+//flipped data bit therefore flips exactly one of each odd/even pair and the
+//odd half of the syndrome is the bit address of the error within the chunk.
+EFI_STATUS
+NandCorrectEcc (
+  IN OUT UINT8                      *Buffer,
+  IN     UINT8                      *StoredEcc
+  )
+{
+  UINTN      Index;
+  UINT8      *CalculatedEcc;
+  UINT8      Syndrome[3];
+  UINTN      OddSyndrome;
+  UINTN      EvenSyndrome;
+  EFI_STATUS Status = EFI_SUCCESS;
+
+  for (Index = 0; Index < gNum512BytesChunks; Index++, Buffer += PAGE_SIZE_512B, StoredEcc += 3) {
+    CalculatedEcc = &gEccCode[Index * 3];
+
+    Syndrome[0] = CalculatedEcc[0] ^ StoredEcc[0];
+    Syndrome[1] = CalculatedEcc[1] ^ StoredEcc[1];
+    Syndrome[2] = CalculatedEcc[2] ^ StoredEcc[2];
+
+    //No error.
+    if ((Syndrome[0] | Syndrome[1] | Syndrome[2]) == 0) {
+      continue;
+    }
+
+    //Chunk was never programmed (erased page), there is no ECC to check against.
+    if ((StoredEcc[0] & StoredEcc[1] & StoredEcc[2]) == 0xFF) {
+      continue;
+    }
+
+    //Single bit error in the stored ECC itself, data is good.
+    if ((gEccBitCount[Syndrome[0]] + gEccBitCount[Syndrome[1]] + gEccBitCount[Syndrome[2]]) == 1) {
+      gNandEccStatistics.CorrectedBits++;
+      continue;
+    }
+
+    OddSyndrome  = Syndrome[0] | ((Syndrome[2] & 0x0F) << 8);
+    EvenSyndrome = Syndrome[1] | ((Syndrome[2] & 0xF0) << 4);
+
+    //Single bit error in the data, flip it back.
+    if ((OddSyndrome ^ EvenSyndrome) == ECC_SYNDROME_MASK) {
+      Buffer[ECC_LOCATION_BYTE(OddSyndrome)] ^= (UINT8)(1 << ECC_LOCATION_BIT(OddSyndrome));
+      gNandEccStatistics.CorrectedBits++;
+      continue;
+    }
+
+    gNandEccStatistics.UncorrectableChunks++;
+    Status = EFI_DEVICE_ERROR;
+  }
+
+  return Status;
+}
+
+//Return the performance counter ticks between Start and now.
+UINT64
+NandElapsedTicks (
+  IN UINT64  Start
+  )
+{
+  UINT64 Now;
+  UINT64 StartValue;
+  UINT64 EndValue;
+
+  Now = GetPerformanceCounter ();
+  GetPerformanceCounterProperties (&StartValue, &EndValue);
+
+  if (EndValue >= StartValue) {
+    return (Now >= Start) ? (Now - Start) : ((EndValue - Start) + (Now - StartValue) + 1);
+  } else {
+    return (Now <= Start) ? (Start - Now) : ((Start - EndValue) + (StartValue - Now) + 1);
+  }
+}
+
+//Convert a timeout to performance counter ticks.
+UINT64
+NandTimeoutTicks (
+  IN UINTN  TimeoutUs
+  )
+{
+  return DivU64x32 (MultU64x32 (GetPerformanceCounterProperties (NULL, NULL), (UINT32)TimeoutUs), 1000000) + 1;
+}
+
+VOID
+NandStopPrefetchEngine (
+  VOID
+  )
+{
+  MmioWrite32 (GPMC_PREFETCH_CONTROL, STOPENGINE);
+  MmioAnd32 (GPMC_PREFETCH_CONFIG1, ~ENABLEENGINE);
+}
+
+//Let sDMA service the prefetch FIFO. The engine raises a request each time
+//NAND_PREFETCH_THRESHOLD bytes can be moved, so one frame is one request.
+EFI_STATUS
+NandPrefetchDmaTransfer (
+  IN OUT VOID                       *Buffer,
+  IN     UINTN                      Size,
+  IN     BOOLEAN                    Write
+  )
+{
+  EFI_STATUS            Status;
+  OMAP_DMA4             Dma4;
+  UINTN                 DmaSize = Size;
+  VOID                  *BufferMap;
+  EFI_PHYSICAL_ADDRESS  BufferAddress;
+  UINT64                Start;
+  UINT64                Timeout;
+
+  Status = DmaMap (Write ? MapOperationBusMasterRead : MapOperationBusMasterWrite, Buffer, &DmaSize, &BufferAddress, &BufferMap);
+  if (EFI_ERROR (Status)) {
+    return Status;
+  }
+
+  ZeroMem (&Dma4, sizeof (OMAP_DMA4));
+
+  Dma4.DataType = 2;                      // DMA4_CSDPi[1:0]   32-bit elements
+  Dma4.ReadPortAccessType = 3;            // DMA4_CSDPi[8:7]   Burst 16x32
+  Dma4.WritePortAccessType = 3;           // DMA4_CSDPi[15:14] Burst 16x32
+  Dma4.WriteMode = 1;                     // DMA4_CSDPi[17:16] Write posted
+  Dma4.NumberOfElementPerFrame = NAND_PREFETCH_THRESHOLD / 4;  // DMA4_CENi
+  Dma4.NumberOfFramePerTransferBlock = Size / NAND_PREFETCH_THRESHOLD;  // DMA4_CFNi
+  Dma4.SourceElementIndex = 1;            // DMA4_CSEi
+  Dma4.DestinationElementIndex = 1;       // DMA4_CDEi
+  Dma4.ReadRequestNumber = GPMC_DMA_REQUEST;  // DMA4_CCRi[4:0]
+
+  if (Write) {
+    Dma4.SourceStartAddress = (UINT32)BufferAddress;  // DMA4_CSSAi
+    Dma4.DestinationStartAddress = GPMC_CS0_BASE;     // DMA4_CDSAi
+    Dma4.ReadPortAccessMode = 1;          // DMA4_CCRi[13:12]  Post increment memory address
+    Dma4.WritePortAccessMode = 0;         // DMA4_CCRi[15:14]  Always write the FIFO
+  } else {
+    Dma4.SourceStartAddress = GPMC_CS0_BASE;          // DMA4_CSSAi
+    Dma4.DestinationStartAddress = (UINT32)BufferAddress;  // DMA4_CDSAi
+    Dma4.ReadPortAccessMode = 0;          // DMA4_CCRi[13:12]  Always read the FIFO
+    Dma4.WritePortAccessMode = 1;         // DMA4_CCRi[15:14]  Post increment memory address
+  }
+
+  //Frame synchronized, requests come from the source on reads and from the
+  //destination on writes. EnableDmaChannel() preserves these CCR bits.
+  MmioAndThenOr32 (
+    DMA4_CCR (NAND_DMA_CHANNEL),
+    ~(DMA4_CCR_FS_PACKET | DMA4_CCR_SEL_SRC_DEST_SYNC_SOURCE),
+    DMA4_CCR_FS_FRAME | (Write ? 0 : DMA4_CCR_SEL_SRC_DEST_SYNC_SOURCE)
+    );
+
+  Status = EnableDmaChannel (NAND_DMA_CHANNEL, &Dma4);
+  if (!EFI_ERROR (Status)) {
+    MmioWrite32 (GPMC_PREFETCH_CONTROL, STARTENGINE);
+
+    Timeout = NandTimeoutTicks (NAND_DMA_TIMEOUT_US);
+    Start = GetPerformanceCounter ();
+    while ((MmioRead32 (DMA4_CSR (NAND_DMA_CHANNEL)) & (DMA4_CSR_BLOCK | DMA4_CSR_ERR)) == 0) {
+      if (NandElapsedTicks (Start) >= Timeout) {
+        Status = EFI_TIMEOUT;
+        break;
+      }
+    }
+
+    if (Status == EFI_TIMEOUT) {
+      DEBUG ((EFI_D_ERROR, "Prefetch DMA timed out.\n"));
+
+      //Stop the requests, then the channel, before the buffer is unmapped.
+      NandStopPrefetchEngine ();
+      MmioAnd32 (DMA4_CCR (NAND_DMA_CHANNEL), ~DMA4_CCR_ENABLE);
+      Start = GetPerformanceCounter ();
+      while ((MmioRead32 (DMA4_CCR (NAND_DMA_CHANNEL)) & (DMA4_CCR_RD_ACTIVE | DMA4_CCR_WR_ACTIVE)) != 0) {
+        if (NandElapsedTicks (Start) >= Timeout) {
+          break;
+        }
+      }
+      MmioWrite32 (DMA4_CICR (NAND_DMA_CHANNEL), 0);
+      MmioWrite32 (DMA4_CSR (NAND_DMA_CHANNEL), DMA4_CSR_RESET);
+    } else {
+      Status = DisableDmaChannel (NAND_DMA_CHANNEL, DMA4_CSR_BLOCK, DMA4_CSR_ERR);
+    }
+  }
+
+  //Leave the channel element synchronized for other users.
+  MmioAnd32 (DMA4_CCR (NAND_DMA_CHANNEL), ~(DMA4_CCR_FS_PACKET | DMA4_CCR_SEL_SRC_DEST_SYNC_SOURCE));
+
+  DmaUnmap (BufferMap);
+
+  return Status;
+}
+
+//Read the main area of a page through the prefetch engine.
+EFI_STATUS
+NandPrefetchRead (
+  OUT VOID                          *Buffer,
+  IN  UINTN                         Size
+  )
+{
+  UINT32     *WordBuffer = Buffer;
+  UINTN      Remaining = Size;
+  UINTN      Available;
+  UINT64     Start;
+  UINT64     Timeout;
+  EFI_STATUS Status = EFI_SUCCESS;
+
+  MmioWrite32 (GPMC_PREFETCH_CONFIG2, Size);
+
+  if (FeaturePcdGet (PcdOmap35xxNandDma)) {
+    MmioWrite32 (GPMC_PREFETCH_CONFIG1, ENGINECS_0 | FIFOTHRESHOLD (NAND_PREFETCH_THRESHOLD) | ENABLEENGINE | DMAMODE | ACCESSMODE_READ);
+    Status = NandPrefetchDmaTransfer (Buffer, Size, FALSE);
+    NandStopPrefetchEngine ();
+    return Status;
+  }
+
+  MmioWrite32 (GPMC_PREFETCH_CONFIG1, ENGINECS_0 | FIFOTHRESHOLD (NAND_PREFETCH_THRESHOLD) | ENABLEENGINE | ACCESSMODE_READ);
+  MmioWrite32 (GPMC_PREFETCH_CONTROL, STARTENGINE);
+
+  Timeout = NandTimeoutTicks (NAND_FIFO_TIMEOUT_US);
+  Start = GetPerformanceCounter ();
+
+  while (Remaining) {
+    //FIFOPOINTER is the number of bytes ready in the FIFO.
+    Available = MIN (FIFOPOINTER (MmioRead32 (GPMC_PREFETCH_STATUS)), Remaining) & ~0x3;
+    if (Available == 0) {
+      if (NandElapsedTicks (Start) >= Timeout) {
+        DEBUG ((EFI_D_ERROR, "Prefetch read timed out.\n"));
+        Status = EFI_TIMEOUT;
+        break;
+      }
+      continue;
+    }
+
+    Remaining -= Available;
+    for (; Available; Available -= 4) {
+      *WordBuffer++ = MmioRead32 (GPMC_CS0_BASE);
+    }
+    Start = GetPerformanceCounter ();
+  }
+
+  NandStopPrefetchEngine ();
+
+  return Status;
+}
+
+//Write the main area of a page through the write-posting engine.
+EFI_STATUS
+NandPostedWrite (
+  IN  VOID                          *Buffer,
+  IN  UINTN                         Size
+  )
+{
+  UINT32     *WordBuffer = Buffer;
+  UINTN      Remaining = Size;
+  UINTN      Available;
+  UINT64     Start;
+  UINT64     Timeout;
+  EFI_STATUS Status = EFI_SUCCESS;
+
+  Timeout = NandTimeoutTicks (NAND_FIFO_TIMEOUT_US);
+
+  MmioWrite32 (GPMC_PREFETCH_CONFIG2, Size);
+
+  if (FeaturePcdGet (PcdOmap35xxNandDma)) {
+    MmioWrite32 (GPMC_PREFETCH_CONFIG1, ENGINECS_0 | FIFOTHRESHOLD (NAND_PREFETCH_THRESHOLD) | ENABLEENGINE | DMAMODE | ACCESSMODE_WRITE);
+    Status = NandPrefetchDmaTransfer (Buffer, Size, TRUE);
+  } else {
+    MmioWrite32 (GPMC_PREFETCH_CONFIG1, ENGINECS_0 | FIFOTHRESHOLD (NAND_PREFETCH_THRESHOLD) | ENABLEENGINE | ACCESSMODE_WRITE);
+    MmioWrite32 (GPMC_PREFETCH_CONTROL, STARTENGINE);
+
+    Start = GetPerformanceCounter ();
+    while (Remaining) {
+      //FIFOPOINTER is the number of free bytes in the FIFO.
+      Available = MIN (FIFOPOINTER (MmioRead32 (GPMC_PREFETCH_STATUS)), Remaining) & ~0x3;
+      if (Available == 0) {
+        if (NandElapsedTicks (Start) >= Timeout) {
+          Status = EFI_TIMEOUT;
+          break;
+        }
+        continue;
+      }
+
+      Remaining -= Available;
+      for (; Available; Available -= 4) {
+        MmioWrite32 (GPMC_CS0_BASE, *WordBuffer++);
+      }
+      Start = GetPerformanceCounter ();
+    }
+  }
+
+  //Wait for the engine to post the last bytes to the device.
+  Start = GetPerformanceCounter ();
+  while (!EFI_ERROR (Status) && (COUNTVALUE (MmioRead32 (GPMC_PREFETCH_STATUS)) != 0)) {
+    if (NandElapsedTicks (Start) >= Timeout) {
+      Status = EFI_TIMEOUT;
+    }
+  }
+
+  if (EFI_ERROR (Status)) {
+    DEBUG ((EFI_D_ERROR, "Posted write failed: %x\n", Status));
+  }
+
+  NandStopPrefetchEngine ();
+
+  return Status;
+}
+
+VOID
+EFIAPI
+NandInterruptHandler (
+  IN  HARDWARE_INTERRUPT_SOURCE   Source,
+  IN  EFI_SYSTEM_CONTEXT          SystemContext
+  )
+{
+  if (MmioRead32 (GPMC_IRQSTATUS) & WAIT0EDGEDETECTION) {
+    MmioWrite32 (GPMC_IRQSTATUS, WAIT0EDGEDETECTION);
+    gNandReady = TRUE;
+  }
+}
+
+//Use the GPMC interrupt for ready edges, polling GPMC_IRQSTATUS is kept
+//if the interrupt cannot be registered.
+VOID
+NandInitializeWaitInterrupt (
+  VOID
+  )
+{
+  EFI_HARDWARE_INTERRUPT_PROTOCOL *Interrupt;
+  EFI_STATUS                      Status;
+
+  Status = gBS->LocateProtocol (&gHardwareInterruptProtocolGuid, NULL, (VOID **)&Interrupt);
+  if (!EFI_ERROR (Status)) {
+    Status = Interrupt->RegisterInterruptSource (Interrupt, GPMC_IRQ, NandInterruptHandler);
+  }
+
+  if (EFI_ERROR (Status)) {
+    DEBUG ((EFI_D_ERROR, "NAND wait interrupt not available: %x\n", Status));
+    return;
+  }
+
+  MmioWrite32 (GPMC_IRQSTATUS, WAIT0EDGEDETECTION);
+  MmioOr32 (GPMC_IRQENABLE, WAIT0EDGEDETECTION);
+}
+
+//Forget R/B# edges of earlier operations. Called before the command or
+//address cycle that makes the part busy.
+VOID
+NandClearReady (
+  VOID
+  )
+{
+  gNandReady = FALSE;
+  MmioWrite32 (GPMC_IRQSTATUS, WAIT0EDGEDETECTION);
+}
+
+//Wait for the rising edge of R/B# on WAIT0. Waiting on the edge instead of
+//READ STATUS keeps the NAND bus free and does not leave the part in status
+//output mode.
+EFI_STATUS
+NandWaitForReady (
+  IN UINTN  TimeoutUs
+  )
+{
+  UINT64 Start;
+  UINT64 Deadline;
+
+  Deadline = NandTimeoutTicks (TimeoutUs);
+  Start = GetPerformanceCounter ();
+
+  do {
+    if (gNandReady) {
+      return EFI_SUCCESS;
+    }
+
+    //Without the interrupt, or before its handler could run, the edge is
+    //still latched in GPMC_IRQSTATUS. A ready level alone does not prove
+    //the part went busy, so it is not accepted.
+    if (MmioRead32 (GPMC_IRQSTATUS) & WAIT0EDGEDETECTION) {
+      MmioWrite32 (GPMC_IRQSTATUS, WAIT0EDGEDETECTION);
+      return EFI_SUCCESS;
+    }
+  } while (NandElapsedTicks (Start) < Deadline);
+
+  return EFI_TIMEOUT;
+}
+
+//Send the command that starts an array operation and wait for it to finish.
+EFI_STATUS
+NandSendCommandAndWait (
+  IN UINT8  Command,
+  IN UINTN  TimeoutUs
+  )
+{
+  NandClearReady();
+  NandSendCommand(Command);
+
+  return NandWaitForReady(TimeoutUs);
+}
+
+//Clock out the page held in the data (or cache) register and correct it.
+EFI_STATUS
+NandReadPageData (
+  OUT VOID                          *Buffer,
+  OUT UINT8                         *SpareBuffer
+  )
+{
+  UINTN      Index;
+  UINTN      NumMainAreaWords = (gNandFlashInfo->PageSize/2);
+  UINTN      NumSpareAreaWords = (gNandFlashInfo->SparePageSize/2);
+  UINT16     *MainAreaWordBuffer = Buffer;
+  UINT16     *SpareAreaWordBuffer = (UINT16 *)SpareBuffer;
+  EFI_STATUS Status;
+
+  //Enable ECC engine.
+  NandEnableEcc();
+
+  //Read data into the buffer.
+  if (FeaturePcdGet(PcdOmap35xxNandPrefetch)) {
+    Status = NandPrefetchRead(Buffer, gNandFlashInfo->PageSize);
+    if (EFI_ERROR(Status)) {
+      NandDisableEcc();
+      return Status;
+    }
+  } else {
+    for (Index = 0; Index < NumMainAreaWords; Index++) {
+      *MainAreaWordBuffer++ = MmioRead16(GPMC_NAND_DATA_0);
+    }
+  }
+
+  //Read spare area into the buffer.
+  for (Index = 0; Index < NumSpareAreaWords; Index++) {
+    *SpareAreaWordBuffer++ = MmioRead16(GPMC_NAND_DATA_0);
+  }
+
+  //Calculate ECC.
+  NandCalculateEcc();
+
+  //Turn off ECC engine.
+  NandDisableEcc();
+
+  //Perform ECC correction.
+  return NandCorrectEcc(Buffer, &SpareBuffer[ECC_POSITION]);
+}
+
+EFI_STATUS
+NandReadPage (
+  IN  UINTN                         BlockIndex,
+  IN  UINTN                         PageIndex,
+  OUT VOID                          *Buffer,
+  OUT UINT8                         *SpareBuffer
+)
+{
+  UINTN      Address;
+  EFI_STATUS Status;
+
+  //Generate device address in bytes to access specific block and page index
+  Address = GetActualPageAddressInBytes(BlockIndex, PageIndex);
+
+  //Send READ command
+  NandSendCommand(PAGE_READ_CMD);
+
+  //Send 5 Address cycles to access specific device address
+  NandSendAddressCycles(Address);
+
+  //Send READ CONFIRM command and wait for the page to load.
+  Status = NandSendCommandAndWait(PAGE_READ_CONFIRM_CMD, NAND_READ_TIMEOUT_US);
+  if (EFI_ERROR(Status)) {
+    DEBUG ((EFI_D_ERROR, "Read page timed out.\n"));
+    return Status;
+  }
+
+  Status = NandReadPageData(Buffer, SpareBuffer);
+  if (EFI_ERROR(Status)) {
+    DEBUG ((EFI_D_ERROR, "Uncorrectable ECC error in Block: %d Page: %d\n", BlockIndex, PageIndex));
+  }
+
+  return Status;
+}
+
+//Read a whole block with sequential cache reads. While one page is clocked
+//out of the cache register the part loads the next page into the data
+//register, hiding the array read time of all pages but the first.
+EFI_STATUS
+NandReadBlockCached (
+  IN  UINTN                         BlockIndex,
+  OUT VOID                          *Buffer,
+  OUT UINT8                         *SpareBuffer
+  )
+{
+  UINTN      PageIndex;
+  EFI_STATUS Status;
+  EFI_STATUS EccStatus = EFI_SUCCESS;
+
+  //Load the first page into the data register.
+  NandSendCommand(PAGE_READ_CMD);
+  NandSendAddressCycles(GetActualPageAddressInBytes(BlockIndex, 0));
+  Status = NandSendCommandAndWait(PAGE_READ_CONFIRM_CMD, NAND_READ_TIMEOUT_US);
+  if (EFI_ERROR(Status)) {
+    return Status;
+  }
+
+  for (PageIndex = 0; PageIndex < gNandFlashInfo->NumPagesPerBlock; PageIndex++) {
+    //Move the page to the cache register and, except for the last page,
+    //start loading the next one.
+    if (PageIndex < (gNandFlashInfo->NumPagesPerBlock - 1)) {
+      Status = NandSendCommandAndWait(READ_CACHE_SEQUENTIAL_CMD, NAND_READ_TIMEOUT_US);
+    } else {
+      Status = NandSendCommandAndWait(READ_CACHE_END_CMD, NAND_READ_TIMEOUT_US);
+    }
+
+    if (EFI_ERROR(Status)) {
+      return Status;
+    }
+
+    Status = NandReadPageData(Buffer, SpareBuffer);
+    if (EFI_ERROR(Status)) {
+      //Keep the sequence going so the part is left idle.
+      DEBUG ((EFI_D_ERROR, "Uncorrectable ECC error in Block: %d Page: %d\n", BlockIndex, PageIndex));
+      EccStatus = Status;
+    }
+
+    Buffer = ((UINT8 *)Buffer + gNandFlashInfo->PageSize);
+  }
+
+  return EccStatus;
+}
+
+EFI_STATUS
+NandReadSpare (
+  IN  UINTN                         BlockIndex,
+  IN  UINTN                         PageIndex,
+  OUT UINT8                         *SpareBuffer
+)
+{
+  UINTN      Address;
+  UINTN      Index;
+  UINTN      NumSpareAreaWords = (gNandFlashInfo->SparePageSize/2);
+  UINT16     *SpareAreaWordBuffer = (UINT16 *)SpareBuffer;
+  EFI_STATUS Status;
+
+  //Generate device address in bytes to access specific block and page index
+  Address = GetActualPageAddressInBytes(BlockIndex, PageIndex);
+
+  //Spare area follows the main area. Column address counts words on x16 parts.
+  if (gNandFlashInfo->Organization == ORGANIZATION_X16) {
+    Address += (gNandFlashInfo->PageSize/2);
+  } else {
+    Address += gNandFlashInfo->PageSize;
+  }
+
+  //Send READ command
+  NandSendCommand(PAGE_READ_CMD);
+
+  //Send 5 Address cycles to access specific device address
+  NandSendAddressCycles(Address);
+
+  //Send READ CONFIRM command and wait for the page to load.
+  Status = NandSendCommandAndWait(PAGE_READ_CONFIRM_CMD, NAND_READ_TIMEOUT_US);
+  if (EFI_ERROR(Status)) {
+    DEBUG ((EFI_D_ERROR, "Read spare timed out.\n"));
+    return Status;
+  }
+
+  //Read spare area into the buffer.
+  for (Index = 0; Index < NumSpareAreaWords; Index++) {
+    *SpareAreaWordBuffer++ = MmioRead16(GPMC_NAND_DATA_0);
+  }
+
+  return EFI_SUCCESS;
+}
+
+//Clock a page and its spare area into the part. The ECC bytes of the spare
+//area are filled in, the rest is provided by the caller.
+EFI_STATUS
+NandWritePageData (
+  IN VOID                           *Buffer,
+  IN UINT8                          *SpareBuffer
+  )
+{
+  UINT16     *MainAreaWordBuffer = Buffer;
+  UINT16     *SpareAreaWordBuffer = (UINT16 *)SpareBuffer;
+  UINTN      Index;
+  EFI_STATUS Status;
+
+  //Enable ECC engine.
+  NandEnableEcc();
+
+  //Data input from Buffer
+  if (FeaturePcdGet(PcdOmap35xxNandPrefetch)) {
+    //The write-posting engine paces the bus accesses itself.
+    Status = NandPostedWrite(Buffer, gNandFlashInfo->PageSize);
+    if (EFI_ERROR(Status)) {
+      NandDisableEcc();
+      return Status;
+    }
+  } else {
+    for (Index = 0; Index < (gNandFlashInfo->PageSize/2); Index++) {
+      MmioWrite16(GPMC_NAND_DATA_0, *MainAreaWordBuffer++);
+
+      //After each write access, device has to wait to accept data.
+      //Currently we may not be programming proper timing parameters to
+      //the GPMC_CONFIGi_0 registers and we would need to figure that out.
+      //Without following delay, page programming fails.
+      gBS->Stall(1);
+    }
+  }
+
+  //Calculate ECC.
+  NandCalculateEcc();
+
+  //Turn off ECC engine.
+  NandDisableEcc();
+
+  //Prepare Spare area buffer with ECC codes.
+  CopyMem(&SpareBuffer[ECC_POSITION], gEccCode, gNum512BytesChunks * 3);
+
+  //Program spare area with calculated ECC.
+  for (Index = 0; Index < (gNandFlashInfo->SparePageSize/2); Index++) {
+    MmioWrite16(GPMC_NAND_DATA_0, *SpareAreaWordBuffer++);
+  }
+
+  return EFI_SUCCESS;
+}
+
+EFI_STATUS
+NandWritePage (
+  IN  UINTN                         BlockIndex,
+  IN  UINTN                         PageIndex,
+  OUT VOID                          *Buffer,
+  IN  UINT8                         *SpareBuffer
+)
+{
+  UINTN      Address;
+  EFI_STATUS Status;
+
+  //Generate device address in bytes to access specific block and page index
+  Address = GetActualPageAddressInBytes(BlockIndex, PageIndex);
+
+  //Send SERIAL DATA INPUT command
+  NandSendCommand(PROGRAM_PAGE_CMD);
+
+  //Send 5 Address cycles to access specific device address
+  NandSendAddressCycles(Address);
+
+  Status = NandWritePageData(Buffer, SpareBuffer);
+  if (EFI_ERROR(Status)) {
+    return Status;
+  }
+
+  //Send PROGRAM command and wait for programming to finish.
+  Status = NandSendCommandAndWait(PROGRAM_PAGE_CONFIRM_CMD, NAND_PROGRAM_TIMEOUT_US);
+  if (EFI_ERROR(Status)) {
+    DEBUG ((EFI_D_ERROR, "Program page timed out.\n"));
+    return Status;
+  }
+
+  //Bit0 indicates Pass/Fail status
+  if (NandReadStatus() & NAND_FAILURE) {
+    return EFI_DEVICE_ERROR;
+  }
+
+  return EFI_SUCCESS;
+}
+
+//Program the same page of the two blocks of a plane pair with one
+//multi-plane program. BlockIndex is the block of the first plane.
+EFI_STATUS
+NandWritePagePair (
+  IN  UINTN                         BlockIndex,
+  IN  UINTN                         PageIndex,
+  IN  VOID                          *Buffer0,
+  IN  VOID                          *Buffer1,
+  IN  UINT8                         *SpareBuffer
+  )
+{
+  EFI_STATUS Status;
+
+  NandSendCommand(PROGRAM_PAGE_CMD);
+  NandSendAddressCycles(GetActualPageAddressInBytes(BlockIndex, PageIndex));
+
+  Status = NandWritePageData(Buffer0, SpareBuffer);
+  if (EFI_ERROR(Status)) {
+    return Status;
+  }
+
+  //Queue the first plane, the part is only busy for tDBSY.
+  Status = NandSendCommandAndWait(PROGRAM_PAGE_MULTI_PLANE_CMD, NAND_READ_TIMEOUT_US);
+  if (EFI_ERROR(Status)) {
+    return Status;
+  }
+
+  SetMem(SpareBuffer, gNandFlashInfo->SparePageSize, 0xFF);
+
+  NandSendCommand(PROGRAM_PAGE_CMD);
+  NandSendAddressCycles(GetActualPageAddressInBytes(BlockIndex + 1, PageIndex));
+
+  Status = NandWritePageData(Buffer1, SpareBuffer);
+  if (EFI_ERROR(Status)) {
+    return Status;
+  }
+
+  //Program both planes.
+  Status = NandSendCommandAndWait(PROGRAM_PAGE_CONFIRM_CMD, NAND_PROGRAM_TIMEOUT_US);
+  if (EFI_ERROR(Status)) {
+    DEBUG ((EFI_D_ERROR, "Multi-plane program timed out.\n"));
+    return Status;
+  }
+
+  //Bit0 reports a failure of either plane.
+  if (NandReadStatus() & NAND_FAILURE) {
+    return EFI_DEVICE_ERROR;
+  }
+
+  return EFI_SUCCESS;
+}
+
+EFI_STATUS
+NandEraseBlock (
+  IN UINTN BlockIndex
+)
+{
+  UINTN      Address;
+  EFI_STATUS Status;
+
+  //Generate device address in bytes to access specific block and page index
+  Address = GetActualPageAddressInBytes(BlockIndex, 0);
+
+  //Send ERASE SETUP command
+  NandSendCommand(BLOCK_ERASE_CMD);
+
+  //Send row address cycles to device to access Page address and Block address
+  NandSendRowAddressCycles(Address >> gNandFlashInfo->PageAddressStart);
+
+  //Send ERASE CONFIRM command and wait for the erase to finish.
+  Status = NandSendCommandAndWait(BLOCK_ERASE_CONFIRM_CMD, NAND_ERASE_TIMEOUT_US);
+  if (EFI_ERROR(Status)) {
+    DEBUG ((EFI_D_ERROR, "Erase block timed out for Block: %d.\n", BlockIndex));
+    return Status;
+  }
+
+  //Bit0 indicates Pass/Fail status
+  if (NandReadStatus() & NAND_FAILURE) {
+    return EFI_DEVICE_ERROR;
+  }
+
+  return EFI_SUCCESS;
+}
+
+//Erase the two blocks of a plane pair with one multi-plane erase.
+EFI_STATUS
+NandEraseBlockPair (
+  IN UINTN BlockIndex
+  )
+{
+  EFI_STATUS Status;
+
+  NandSendCommand(BLOCK_ERASE_CMD);
+  NandSendRowAddressCycles(GetActualPageAddressInBytes(BlockIndex, 0) >> gNandFlashInfo->PageAddressStart);
+
+  //Queue the first plane, the part is only busy for tDBSY.
+  Status = NandSendCommandAndWait(BLOCK_ERASE_MULTI_PLANE_CMD, NAND_READ_TIMEOUT_US);
+  if (EFI_ERROR(Status)) {
+    return Status;
+  }
+
+  NandSendCommand(BLOCK_ERASE_CMD);
+  NandSendRowAddressCycles(GetActualPageAddressInBytes(BlockIndex + 1, 0) >> gNandFlashInfo->PageAddressStart);
+
+  Status = NandSendCommandAndWait(BLOCK_ERASE_CONFIRM_CMD, NAND_ERASE_TIMEOUT_US);
+  if (EFI_ERROR(Status)) {
+    DEBUG ((EFI_D_ERROR, "Multi-plane erase timed out for Block: %d.\n", BlockIndex));
+    return Status;
+  }
+
+  //Bit0 reports a failure of either plane.
+  if (NandReadStatus() & NAND_FAILURE) {
+    return EFI_DEVICE_ERROR;
+  }
+
+  return EFI_SUCCESS;
+}
+
+EFI_STATUS
+NandReadBlock (
+  IN UINTN                          StartBlockIndex,
+  IN UINTN                          EndBlockIndex,
+  OUT VOID                          *Buffer,
+  OUT VOID                          *SpareBuffer
+)
+{
+  UINTN      BlockIndex;
+  UINTN      PhysicalBlockIndex;
+  UINTN      PageIndex;
+  EFI_STATUS Status = EFI_SUCCESS;
+
+  for (BlockIndex = StartBlockIndex; BlockIndex <= EndBlockIndex; BlockIndex++) {
+    //Bad blocks are transparently replaced by a block of the reserved pool.
+    PhysicalBlockIndex = NandTranslateBlock(BlockIndex);
+    if (PhysicalBlockIndex == NAND_BBT_NO_BLOCK) {
+      return EFI_DEVICE_ERROR;
+    }
+
+    if (gNandFlashInfo->ReadCache) {
+      Status = NandReadBlockCached(PhysicalBlockIndex, Buffer, SpareBuffer);
+      if (Status != EFI_TIMEOUT) {
+        if (EFI_ERROR(Status)) {
+          return Status;
+        }
+        Buffer = ((UINT8 *)Buffer + gNandFlashInfo->BlockSize);
+        continue;
+      }
+
+      //The part did not follow the cache read sequence, use page reads from now on.
+      DEBUG ((EFI_D_ERROR, "Cache read timed out, falling back to page reads.\n"));
+      gNandFlashInfo->ReadCache = FALSE;
+      NandFlashReset(NULL, TRUE);
+    }
+
+    //For each block read number of pages
+    for (PageIndex = 0; PageIndex < gNandFlashInfo->NumPagesPerBlock; PageIndex++) {
+      Status = NandReadPage(PhysicalBlockIndex, PageIndex, Buffer, SpareBuffer);
+      if (EFI_ERROR(Status)) {
+        return Status;
+      }
+      Buffer = ((UINT8 *)Buffer + gNandFlashInfo->PageSize);
+    }
+  }
+
+  return Status;
+}
+
+BOOLEAN
+NandIsBufferErased (
+  IN VOID                           *Buffer,
+  IN UINTN                          Size
+  )
+{
+  UINT32 *WordBuffer = Buffer;
+  UINT8  *ByteBuffer;
+
+  for (; Size >= 4; Size -= 4) {
+    if (*WordBuffer++ != 0xFFFFFFFF) {
+      return FALSE;
+    }
+  }
+
+  for (ByteBuffer = (UINT8 *)WordBuffer; Size; Size--) {
+    if (*ByteBuffer++ != 0xFF) {
+      return FALSE;
+    }
+  }
+
+  return TRUE;
+}
+
+//Compare the new content of a block with what the block holds. Pages that
+//already match do not need programming. The changed pages are programmed in
+//place only if they are erased and all come after the last programmed page,
+//since pages of a block have to be programmed in order. Otherwise the block
+//is erased and programmed again from its first page.
+EFI_STATUS
+NandCompareBlock (
+  IN  UINTN                         BlockIndex,
+  IN  UINT8                         *Buffer,
+  IN  UINT8                         *PageBuffer,
+  IN  UINT8                         *SpareBuffer,
+  OUT BOOLEAN                       *ProgramPage,
+  OUT BOOLEAN                       *EraseNeeded
+  )
+{
+  UINTN      PageIndex;
+  UINTN      ProgrammedPages = 0;     //Pages up to the last programmed one
+  UINTN      FirstProgramPage;
+  BOOLEAN    PageErased;
+  EFI_STATUS Status;
+
+  *EraseNeeded = FALSE;
+  FirstProgramPage = gNandFlashInfo->NumPagesPerBlock;
+
+  for (PageIndex = 0; PageIndex < gNandFlashInfo->NumPagesPerBlock; PageIndex++, Buffer += gNandFlashInfo->PageSize) {
+    Status = NandReadPage(BlockIndex, PageIndex, PageBuffer, SpareBuffer);
+    if (Status == EFI_TIMEOUT) {
+      return Status;
+    }
+
+    PageErased = !EFI_ERROR(Status) &&
+                 NandIsBufferErased(PageBuffer, gNandFlashInfo->PageSize) &&
+                 NandIsBufferErased(SpareBuffer, gNandFlashInfo->SparePageSize);
+    if (!PageErased) {
+      ProgrammedPages = PageIndex + 1;
+    }
+
+    if (!EFI_ERROR(Status) && (CompareMem(PageBuffer, Buffer, gNandFlashInfo->PageSize) == 0)) {
+      ProgramPage[PageIndex] = FALSE;
+      continue;
+    }
+
+    //Pages of all 0xFF are left erased.
+    ProgramPage[PageIndex] = !NandIsBufferErased(Buffer, gNandFlashInfo->PageSize);
+    if (ProgramPage[PageIndex] && (FirstProgramPage == gNandFlashInfo->NumPagesPerBlock)) {
+      FirstProgramPage = PageIndex;
+    }
+
+    if (!PageErased) {
+      *EraseNeeded = TRUE;
+    }
+  }
+
+  //Programming an erased page below a programmed one would be out of order.
+  if (FirstProgramPage < ProgrammedPages) {
+    *EraseNeeded = TRUE;
+  }
+
+  //After an erase every page that is not blank has to be programmed again.
+  if (*EraseNeeded) {
+    Buffer -= gNandFlashInfo->BlockSize;
+    for (PageIndex = 0; PageIndex < gNandFlashInfo->NumPagesPerBlock; PageIndex++, Buffer += gNandFlashInfo->PageSize) {
+      ProgramPage[PageIndex] = !NandIsBufferErased(Buffer, gNandFlashInfo->PageSize);
+    }
+  }
+
+  return EFI_SUCCESS;
+}
+
+//Update one user area block. Erase and program failures retire the block
+//and the data is written to a replacement block instead.
+EFI_STATUS
+NandEraseAndWriteBlock (
+  IN UINTN                          BlockIndex,
+  IN VOID                           *Buffer,
+  IN UINT8                          *PageBuffer,
+  IN UINT8                          *SpareBuffer,
+  IN BOOLEAN                        *ProgramPage
+  )
+{
+  UINTN      PhysicalBlockIndex;
+  UINTN      PageIndex;
+  BOOLEAN    EraseNeeded;
+  EFI_STATUS Status;
+
+  PhysicalBlockIndex = NandTranslateBlock(BlockIndex);
+
+  while (PhysicalBlockIndex != NAND_BBT_NO_BLOCK) {
+    Status = NandCompareBlock(PhysicalBlockIndex, Buffer, PageBuffer, SpareBuffer, ProgramPage, &EraseNeeded);
+    if (EFI_ERROR(Status)) {
+      return Status;
+    }
+
+    if (EraseNeeded) {
+      Status = NandEraseBlock(PhysicalBlockIndex);
+    }
+
+    for (PageIndex = 0; !EFI_ERROR(Status) && (PageIndex < gNandFlashInfo->NumPagesPerBlock); PageIndex++) {
+      if (ProgramPage[PageIndex]) {
+        SetMem(SpareBuffer, gNandFlashInfo->SparePageSize, 0xFF);
+        Status = NandWritePage(PhysicalBlockIndex, PageIndex, (UINT8 *)Buffer + (PageIndex * gNandFlashInfo->PageSize), SpareBuffer);
+      }
+    }
+
+    if (Status != EFI_DEVICE_ERROR) {
+      return Status;
+    }
+
+    PhysicalBlockIndex = NandReplaceBadBlock(BlockIndex);
+  }
+
+  return EFI_DEVICE_ERROR;
+}
+
+//Update two user area blocks that sit in adjacent planes with multi-plane
+//erase and program. Returns EFI_UNSUPPORTED if the blocks cannot be paired,
+//and any failure leaves the blocks to NandEraseAndWriteBlock(), which
+//retires bad blocks.
+EFI_STATUS
+NandEraseAndWriteBlockPair (
+  IN UINTN                          BlockIndex,
+  IN VOID                           *Buffer,
+  IN UINT8                          *PageBuffer,
+  IN UINT8                          *SpareBuffer,
+  IN BOOLEAN                        *ProgramPage
+  )
+{
+  UINT8      *Buffer1 = (UINT8 *)Buffer + gNandFlashInfo->BlockSize;
+  BOOLEAN    *ProgramPage1 = ProgramPage + gNandFlashInfo->NumPagesPerBlock;
+  BOOLEAN    EraseNeeded;
+  BOOLEAN    EraseNeeded1;
+  UINTN      PageIndex;
+  UINTN      PageOffset;
+  EFI_STATUS Status;
+
+  //Both blocks have to be in place, a replacement block may sit in any plane.
+  if ((gNandFlashInfo->PlaneCount < 2) || (BlockIndex & 1) ||
+      (NandTranslateBlock(BlockIndex) != BlockIndex) || (NandTranslateBlock(BlockIndex + 1) != BlockIndex + 1)) {
+    return EFI_UNSUPPORTED;
+  }
+
+  Status = NandCompareBlock(BlockIndex, Buffer, PageBuffer, SpareBuffer, ProgramPage, &EraseNeeded);
+  if (!EFI_ERROR(Status)) {
+    Status = NandCompareBlock(BlockIndex + 1, Buffer1, PageBuffer, SpareBuffer, ProgramPage1, &EraseNeeded1);
+  }
+
+  if (EFI_ERROR(Status)) {
+    return Status;
+  }
+
+  if (EraseNeeded && EraseNeeded1) {
+    Status = NandEraseBlockPair(BlockIndex);
+  } else if (EraseNeeded) {
+    Status = NandEraseBlock(BlockIndex);
+  } else if (EraseNeeded1) {
+    Status = NandEraseBlock(BlockIndex + 1);
+  }
+
+  for (PageIndex = 0; !EFI_ERROR(Status) && (PageIndex < gNandFlashInfo->NumPagesPerBlock); PageIndex++) {
+    PageOffset = PageIndex * gNandFlashInfo->PageSize;
+    SetMem(SpareBuffer, gNandFlashInfo->SparePageSize, 0xFF);
+
+    if (ProgramPage[PageIndex] && ProgramPage1[PageIndex]) {
+      Status = NandWritePagePair(BlockIndex, PageIndex, (UINT8 *)Buffer + PageOffset, Buffer1 + PageOffset, SpareBuffer);
+    } else if (ProgramPage[PageIndex]) {
+      Status = NandWritePage(BlockIndex, PageIndex, (UINT8 *)Buffer + PageOffset, SpareBuffer);
+    } else if (ProgramPage1[PageIndex]) {
+      Status = NandWritePage(BlockIndex + 1, PageIndex, Buffer1 + PageOffset, SpareBuffer);
+    }
+  }
+
+  return Status;
+}
+
+EFI_STATUS
+EFIAPI
+NandFlashReset (
+  IN EFI_BLOCK_IO_PROTOCOL          *This,
+  IN BOOLEAN                        ExtendedVerification
+  )
+{
+  UINTN      BusyStall = 50;                            // microSeconds
+  UINTN      ResetBusyTimeout = (1000000 / BusyStall);  // 1 Second
+  EFI_TPL    OldTpl;
+  EFI_STATUS Status = EFI_SUCCESS;
+
+  OldTpl = gBS->RaiseTPL (NAND_TPL);
+
+  //Send RESET command to device.
+  NandSendCommand(RESET_CMD);
+
+  //Wait for 1ms before we check status register.
+  gBS->Stall(1000);
+
+  //Check BIT#5 & BIT#6 in Status register to make sure RESET is done.
+  while ((NandReadStatus() & NAND_RESET_STATUS) != NAND_RESET_STATUS) {
+
+    //In case of extended verification, wait for extended amount of time
+    //to make sure device is reset.
+    if (ExtendedVerification) {
+      if (ResetBusyTimeout == 0) {
+        Status = EFI_DEVICE_ERROR;
+        break;
+      }
+
+      gBS->Stall(BusyStall);
+      ResetBusyTimeout--;
+    }
+  }
+
+  gBS->RestoreTPL (OldTpl);
+
+  return Status;
+}
+
+EFI_STATUS
+EFIAPI
+NandFlashReadBlocks (
+  IN EFI_BLOCK_IO_PROTOCOL          *This,
+  IN UINT32                         MediaId,
+  IN EFI_LBA                        Lba,
+  IN UINTN                          BufferSize,
+  OUT VOID                          *Buffer
+  )
+{
+  UINTN      NumBlocks;
+  UINTN      EndBlockIndex;
+  EFI_TPL    OldTpl;
+  EFI_STATUS Status;
+  UINT8      *SpareBuffer = NULL;
+
+  if (Buffer == NULL) {
+    Status = EFI_INVALID_PARAMETER;
+    goto exit;
+  }
+
+  if (Lba > LAST_BLOCK) {
+    Status = EFI_INVALID_PARAMETER;
+    goto exit;
+  }
+
+  if ((BufferSize % gNandFlashInfo->BlockSize) != 0) {
+    Status = EFI_BAD_BUFFER_SIZE;
+    goto exit;
+  }
+
+  NumBlocks = DivU64x32(BufferSize, gNandFlashInfo->BlockSize);
+  EndBlockIndex = ((UINTN)Lba + NumBlocks) - 1;
+
+  if (EndBlockIndex > LAST_BLOCK) {
+    Status = EFI_INVALID_PARAMETER;
+    goto exit;
+  }
+
+  SpareBuffer = (UINT8 *)AllocatePool(gNandFlashInfo->SparePageSize);
+  if (SpareBuffer == NULL) {
+    Status = EFI_OUT_OF_RESOURCES;
+    goto exit;
+  }
+
+  //Read block
+  OldTpl = gBS->RaiseTPL (NAND_TPL);
+  Status = NandReadBlock((UINTN)Lba, EndBlockIndex, Buffer, SpareBuffer);
+  gBS->RestoreTPL (OldTpl);
+  if (EFI_ERROR(Status)) {
+    DEBUG((EFI_D_ERROR, "Read block fails: %x\n", Status));
+    goto exit;
+  }
+
+exit:
+  if (SpareBuffer != NULL) {
+    FreePool (SpareBuffer);
+  }
+
+  return Status;
+}
+
+EFI_STATUS
+EFIAPI
+NandFlashWriteBlocks (
+  IN EFI_BLOCK_IO_PROTOCOL          *This,
+  IN UINT32                         MediaId,
+  IN EFI_LBA                        Lba,
+  IN UINTN                          BufferSize,
+  IN VOID                           *Buffer
+  )
+{
+  UINTN      BlockIndex;
+  UINTN      NumBlocks;
+  UINTN      EndBlockIndex;
+  EFI_STATUS Status;
+  UINT8      *SpareBuffer = NULL;
+  UINT8      *PageBuffer = NULL;
+  BOOLEAN    *ProgramPage = NULL;
+  EFI_TPL    OldTpl;
+
+  if (Buffer == NULL) {
+    Status = EFI_INVALID_PARAMETER;
+    goto exit;
+  }
+
+  if (Lba > LAST_BLOCK) {
+    Status = EFI_INVALID_PARAMETER;
+    goto exit;
+  }
+
+  if ((BufferSize % gNandFlashInfo->BlockSize) != 0) {
+    Status = EFI_BAD_BUFFER_SIZE;
+    goto exit;
+  }
+
+  NumBlocks = DivU64x32(BufferSize, gNandFlashInfo->BlockSize);
+  EndBlockIndex = ((UINTN)Lba + NumBlocks) - 1;
+
+  if (EndBlockIndex > LAST_BLOCK) {
+    Status = EFI_INVALID_PARAMETER;
+    goto exit;
+  }
+
+  //The flash translation layer region is only written through its own BlockIo.
+  if (NandFtlOwnsBlocks((UINTN)Lba, EndBlockIndex)) {
+    Status = EFI_INVALID_PARAMETER;
+    goto exit;
+  }
+
+  SpareBuffer = (UINT8 *)AllocatePool(gNandFlashInfo->SparePageSize);
+  PageBuffer = (UINT8 *)AllocatePool(gNandFlashInfo->PageSize);
+  ProgramPage = (BOOLEAN *)AllocatePool(2 * gNandFlashInfo->NumPagesPerBlock * sizeof(BOOLEAN));
+  if ((SpareBuffer == NULL) || (PageBuffer == NULL) || (ProgramPage == NULL)) {
+    Status = EFI_OUT_OF_RESOURCES;
+    goto exit;
+  }
+
+  // Erase and program data
+  OldTpl = gBS->RaiseTPL (NAND_TPL);
+  for (BlockIndex = (UINTN)Lba; BlockIndex <= EndBlockIndex; BlockIndex++) {
+    //Blocks in adjacent planes are updated together.
+    if (BlockIndex < EndBlockIndex) {
+      Status = NandEraseAndWriteBlockPair(BlockIndex, Buffer, PageBuffer, SpareBuffer, ProgramPage);
+      if (!EFI_ERROR(Status)) {
+        BlockIndex++;
+        Buffer = ((UINT8 *)Buffer + (2 * gNandFlashInfo->BlockSize));
+        continue;
+      }
+
+      if (Status == EFI_TIMEOUT) {
+        break;
+      }
+    }
+
+    Status = NandEraseAndWriteBlock(BlockIndex, Buffer, PageBuffer, SpareBuffer, ProgramPage);
+    if (EFI_ERROR(Status)) {
+      break;
+    }
+    Buffer = ((UINT8 *)Buffer + gNandFlashInfo->BlockSize);
+  }
+  gBS->RestoreTPL (OldTpl);
+
+  if (EFI_ERROR(Status)) {
+    DEBUG((EFI_D_ERROR, "Block write fails: %x\n", Status));
+  }
+
+exit:
+  if (SpareBuffer != NULL) {
+    FreePool (SpareBuffer);
+  }
+
+  if (PageBuffer != NULL) {
+    FreePool (PageBuffer);
+  }
+
+  if (ProgramPage != NULL) {
+    FreePool (ProgramPage);
+  }
+
+  return Status;
+}
+
+EFI_STATUS
+EFIAPI
+NandFlashFlushBlocks (
+  IN EFI_BLOCK_IO_PROTOCOL  *This
+  )
+{
+  return EFI_SUCCESS;
+}
+
+
+
+EFI_BLOCK_IO_MEDIA gNandFlashMedia = {
+  SIGNATURE_32('n','a','n','d'),            // MediaId
+  FALSE,                                    // RemovableMedia
+  TRUE,                                     // MediaPresent
+  FALSE,                                    // LogicalPartition
+  FALSE,                                    // ReadOnly
+  FALSE,                                    // WriteCaching
+  0,                                        // BlockSize
+  4,                                        // IoAlign
+  0,                                        // Pad
+  0                                         // LastBlock
+};
+
+EFI_BLOCK_IO_PROTOCOL BlockIo =
+{
+  EFI_BLOCK_IO_INTERFACE_REVISION,  // Revision
+  &gNandFlashMedia,                  // *Media
+  NandFlashReset,                   // Reset
+  NandFlashReadBlocks,              // ReadBlocks
+  NandFlashWriteBlocks,             // WriteBlocks
+  NandFlashFlushBlocks              // FlushBlocks
+};
+
+EFI_STATUS
+NandFlashInitialize (
+  IN EFI_HANDLE         ImageHandle,
+  IN EFI_SYSTEM_TABLE   *SystemTable
+  )
+{
+  EFI_STATUS  Status;
+
+  gNandFlashInfo = (NAND_FLASH_INFO *)AllocateZeroPool (sizeof(NAND_FLASH_INFO));
+
+  //Initialize GPMC module.
+  GpmcInit();
+
+  if (FeaturePcdGet(PcdOmap35xxNandWaitInterrupt)) {
+    NandInitializeWaitInterrupt();
+  }
+
+  //Reset NAND part
+  NandFlashReset(&BlockIo, FALSE);
+
+  //Detect NAND part and populate gNandFlashInfo structure
+  Status = NandDetectPart ();
+  if (EFI_ERROR(Status)) {
+    DEBUG((EFI_D_ERROR, "Nand part id detection failure: Status: %x\n", Status));
+    return Status;
+  }
+
+  //Count total number of 512Bytes chunk based on the page size.
+  gNum512BytesChunks = gNandFlashInfo->PageSize / PAGE_SIZE_512B;
+
+  gEccCode = (UINT8 *)AllocatePool(gNum512BytesChunks * 3);
+  if (gEccCode == NULL) {
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  NandInitializeEccTables ();
+
+  //Configure ECC
+  NandConfigureEcc ();
+
+  //Load the bad block table, or build it on first boot. This decides LAST_BLOCK.
+  Status = NandBbtInitialize ();
+  if (EFI_ERROR(Status)) {
+    DEBUG((EFI_D_ERROR, "Nand bad block table failure: Status: %x\n", Status));
+    return Status;
+  }
+
+  //Patch EFI_BLOCK_IO_MEDIA structure.
+  gNandFlashMedia.BlockSize = gNandFlashInfo->BlockSize;
+  gNandFlashMedia.LastBlock = LAST_BLOCK;
+
+  //Publish BlockIO.
+  Status = gBS->InstallMultipleProtocolInterfaces (
+                  &ImageHandle,
+                  &gEfiBlockIoProtocolGuid, &BlockIo,
+                  &gEfiDevicePathProtocolGuid, &gDevicePath,
+                  NULL
+                  );
+  if (EFI_ERROR(Status)) {
+    return Status;
+  }
+
+  //Publish the flash translation layer, if a region is assigned to it.
+  Status = NandFtlInitialize ();
+  if (EFI_ERROR(Status)) {
+    DEBUG((EFI_D_ERROR, "Nand FTL initialization failure: Status: %x\n", Status));
+  }
+
+  return EFI_SUCCESS;
+}
+
@@ -1,106 +1,391 @@
-/** @file
-
-  Copyright (c) 2008 - 2009, Apple Inc. All rights reserved.<BR>
-
-  This program and the accompanying materials
-  are licensed and made available under the terms and conditions of the BSD License
-  which accompanies this distribution.  The full text of the license may be found at
-  http://opensource.org/licenses/bsd-license.php
-
-  THE PROGRAM IS DISTRIBUTED UNDER THE BSD LICENSE ON AN "AS IS" BASIS,
-  WITHOUT WARRANTIES OR REPRESENTATIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED.
-
-**/
-
-#ifndef FLASH_H
-#define FLASH_H
-
-#include <Uefi.h>
-
-#include <Library/BaseLib.h>
-#include <Library/BaseMemoryLib.h>
-#include <Library/MemoryAllocationLib.h>
-#include <Library/DebugLib.h>
-#include <Library/IoLib.h>
-#include <Library/PcdLib.h>
-#include <Library/UefiBootServicesTableLib.h>
-#include <Library/IoLib.h>
-
-#include <Protocol/BlockIo.h>
-#include <Protocol/Cpu.h>
-#include <Omap3530/Omap3530.h>
-
-#define PAGE_SIZE(x)             ((x) & 0x01)
-#define PAGE_SIZE_2K_VAL         (0x01UL)
-
-#define SPARE_AREA_SIZE(x)       (((x) >> 2) & 0x01)
-#define SPARE_AREA_SIZE_64B_VAL  (0x1UL)
-
-#define BLOCK_SIZE(x)            (((x) >> 4) & 0x01)
-#define BLOCK_SIZE_128K_VAL      (0x01UL)
-
-#define ORGANIZATION(x)          (((x) >> 6) & 0x01)
-#define ORGANIZATION_X8          (0x0UL)
-#define ORGANIZATION_X16         (0x1UL)
-
-#define PAGE_SIZE_512B           (512)
-#define PAGE_SIZE_2K             (2048)
-#define PAGE_SIZE_4K             (4096)
-#define SPARE_AREA_SIZE_16B      (16)
-#define SPARE_AREA_SIZE_64B      (64)
-
-#define BLOCK_SIZE_16K           (16*1024)
-#define BLOCK_SIZE_128K          (128*1024)
-
-#define BLOCK_COUNT              (2048)
-#define LAST_BLOCK               (BLOCK_COUNT - 1)
-
-#define ECC_POSITION             2
-
-//List of commands.
-#define RESET_CMD                0xFF
-#define READ_ID_CMD              0x90
-
-#define READ_STATUS_CMD          0x70
-
-#define PAGE_READ_CMD            0x00
-#define PAGE_READ_CONFIRM_CMD    0x30
-
-#define BLOCK_ERASE_CMD          0x60
-#define BLOCK_ERASE_CONFIRM_CMD  0xD0
-
-#define PROGRAM_PAGE_CMD         0x80
-#define PROGRAM_PAGE_CONFIRM_CMD 0x10
-
-//Nand status register bit definition
-#define NAND_SUCCESS             (0x0UL << 0)
-#define NAND_FAILURE             BIT0
-
-#define NAND_BUSY                (0x0UL << 6)
-#define NAND_READY               BIT6
-
-#define NAND_RESET_STATUS        (0x60UL << 0)
-
-#define MAX_RETRY_COUNT          1500
-
-
-typedef struct {
-  UINT8 ManufactureId;
-  UINT8 DeviceId;
-  UINT8 BlockAddressStart; //Start of the Block address in actual NAND
-  UINT8 PageAddressStart;  //Start of the Page address in actual NAND
-} NAND_PART_INFO_TABLE;
-
-typedef struct {
-  UINT8     ManufactureId;
-  UINT8     DeviceId;
-  UINT8     Organization;      //x8 or x16
-  UINT32    PageSize;
-  UINT32    SparePageSize;
-  UINT32    BlockSize;
-  UINT32    NumPagesPerBlock;
-  UINT8     BlockAddressStart; //Start of the Block address in actual NAND
-  UINT8     PageAddressStart;  //Start of the Page address in actual NAND
-} NAND_FLASH_INFO;
-
-#endif //FLASH_H
+/** @file
+
+  Copyright (c) 2008 - 2009, Apple Inc. All rights reserved.<BR>
+
+  This program and the accompanying materials
+  are licensed and made available under the terms and conditions of the BSD License
+  which accompanies this distribution.  The full text of the license may be found at
+  http://opensource.org/licenses/bsd-license.php
+
+  THE PROGRAM IS DISTRIBUTED UNDER THE BSD LICENSE ON AN "AS IS" BASIS,
+  WITHOUT WARRANTIES OR REPRESENTATIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED.
+
+**/
+
+#ifndef FLASH_H
+#define FLASH_H
+
+#include <Uefi.h>
+
+#include <Library/BaseLib.h>
+#include <Library/BaseMemoryLib.h>
+#include <Library/MemoryAllocationLib.h>
+#include <Library/DebugLib.h>
+#include <Library/IoLib.h>
+#include <Library/PcdLib.h>
+#include <Library/UefiBootServicesTableLib.h>
+#include <Library/TimerLib.h>
+#include <Library/OmapDmaLib.h>
+#include <Library/DmaLib.h>
+
+#include <Protocol/BlockIo.h>
+#include <Protocol/Cpu.h>
+#include <Protocol/HardwareInterrupt.h>
+#include <Omap3530/Omap3530.h>
+
+#define PAGE_SIZE(x)             ((x) & 0x01)
+#define PAGE_SIZE_2K_VAL         (0x01UL)
+
+#define SPARE_AREA_SIZE(x)       (((x) >> 2) & 0x01)
+#define SPARE_AREA_SIZE_64B_VAL  (0x1UL)
+
+#define BLOCK_SIZE(x)            (((x) >> 4) & 0x01)
+#define BLOCK_SIZE_128K_VAL      (0x01UL)
+
+#define ORGANIZATION(x)          (((x) >> 6) & 0x01)
+#define ORGANIZATION_X8          (0x0UL)
+#define ORGANIZATION_X16         (0x1UL)
+
+#define PAGE_SIZE_512B           (512)
+#define PAGE_SIZE_2K             (2048)
+#define PAGE_SIZE_4K             (4096)
+#define SPARE_AREA_SIZE_16B      (16)
+#define SPARE_AREA_SIZE_64B      (64)
+
+#define BLOCK_SIZE_16K           (16*1024)
+#define BLOCK_SIZE_128K          (128*1024)
+
+//Largest part supported. Also sizes the bad block table bitmap.
+#define NAND_MAX_BLOCK_COUNT     (8192)
+
+//The GPMC has nine Hamming ECC result registers, one per 512-byte chunk.
+#define NAND_MAX_ECC_CHUNKS      (9)
+
+//Bad block table, used when PcdOmap35xxNandBbt is set. The table lives in
+//the last blocks of the part, preceded by a pool of blocks that replace bad
+//blocks of the user area.
+#define NAND_BBT_SIGNATURE            SIGNATURE_32('N','B','B','T')
+#define NAND_BBT_BLOCKS               4
+#define NAND_BBT_RESERVED_BLOCKS      32
+#define NAND_BBT_FIRST_BLOCK          (gNandFlashInfo->BlockCount - NAND_BBT_BLOCKS)
+#define NAND_BBT_FIRST_RESERVED_BLOCK (NAND_BBT_FIRST_BLOCK - NAND_BBT_RESERVED_BLOCKS)
+#define NAND_BBT_SLOT_FREE            0xFFFF
+#define NAND_BBT_SLOT_BAD             0xFFFE
+#define NAND_BBT_NO_BLOCK             MAX_UINTN
+#define NAND_BBT_READ_RETRIES         3
+
+//Factory bad block marker, first spare byte (word on x16 parts) of page 0 or 1.
+#define BAD_BLOCK_MARKER_POSITION     0
+#define BAD_BLOCK_MARKER_PAGES        2
+
+#define LAST_BLOCK               (gNandBbtEnabled ? (NAND_BBT_FIRST_RESERVED_BLOCK - 1) : (gNandFlashInfo->BlockCount - 1))
+
+#define ECC_POSITION             2
+
+//Hamming ECC syndrome classification for a 512-byte chunk.
+#define ECC_SYNDROME_MASK        (0xFFFUL)
+#define ECC_LOCATION_BYTE(x)     ((x) >> 3)
+#define ECC_LOCATION_BIT(x)      ((x) & 0x07)
+
+//List of commands.
+#define RESET_CMD                0xFF
+#define READ_ID_CMD              0x90
+#define READ_PARAMETER_PAGE_CMD  0xEC
+
+#define READ_STATUS_CMD          0x70
+
+#define PAGE_READ_CMD            0x00
+#define PAGE_READ_CONFIRM_CMD    0x30
+#define READ_CACHE_SEQUENTIAL_CMD 0x31
+#define READ_CACHE_END_CMD       0x3F
+
+#define BLOCK_ERASE_CMD          0x60
+#define BLOCK_ERASE_CONFIRM_CMD  0xD0
+#define BLOCK_ERASE_MULTI_PLANE_CMD 0xD1
+
+#define PROGRAM_PAGE_CMD         0x80
+#define PROGRAM_PAGE_CONFIRM_CMD 0x10
+#define PROGRAM_PAGE_MULTI_PLANE_CMD 0x11
+
+//Nand status register bit definition
+#define NAND_SUCCESS             (0x0UL << 0)
+#define NAND_FAILURE             BIT0
+
+#define NAND_BUSY                (0x0UL << 6)
+#define NAND_READY               BIT6
+
+#define NAND_RESET_STATUS        (0x60UL << 0)
+
+#define MAX_RETRY_COUNT          1500
+
+//Ready/busy deadlines, several times the worst case tR, tPROG and tBERS.
+#define NAND_READ_TIMEOUT_US     500
+#define NAND_PROGRAM_TIMEOUT_US  2000
+#define NAND_ERASE_TIMEOUT_US    10000
+
+//Longest time the prefetch FIFO may go without moving data.
+#define NAND_FIFO_TIMEOUT_US     100
+
+//Longest time sDMA may take to move a page through the prefetch FIFO.
+#define NAND_DMA_TIMEOUT_US      1000
+
+//NAND_PART_INFO_TABLE features.
+#define NAND_FEATURE_READ_CACHE  BIT0
+
+//ONFI parameter page.
+#define ONFI_ID_ADDRESS              0x20
+#define ONFI_SIGNATURE               SIGNATURE_32('O','N','F','I')
+#define ONFI_PARAMETER_PAGE_COPIES   3
+#define ONFI_CRC_POLYNOMIAL          0x8005
+#define ONFI_CRC_SEED                0x4F4E
+
+#define ONFI_FEATURE_16BIT_BUS       BIT0
+#define ONFI_FEATURE_INTERLEAVED     BIT3
+#define ONFI_COMMAND_READ_CACHE      BIT1
+
+//GPMC prefetch/write-posting engine.
+#define NAND_PREFETCH_THRESHOLD  (GPMC_PREFETCH_FIFO_SIZE)
+#define NAND_DMA_CHANNEL         (3)
+
+//Flash translation layer.
+#define NAND_FTL_SIGNATURE           SIGNATURE_16('f','t')
+#define NAND_FTL_SPARE_POSITION      (MAX (16, ECC_POSITION + (gNum512BytesChunks * 3)))  //Page metadata follows the ECC bytes
+#define NAND_FTL_UNMAPPED            MAX_UINT32
+#define NAND_FTL_NO_BLOCK            MAX_UINTN
+#define NAND_FTL_RESERVED_BLOCKS(x)  (MAX (4, (x) / 32))
+#define NAND_FTL_MIN_FREE_BLOCKS     2      //Write path reclaims space below this
+#define NAND_FTL_GC_FREE_BLOCKS      4      //Background GC reclaims space below this
+#define NAND_FTL_WEAR_THRESHOLD      64     //Erase count spread that triggers static wear levelling
+#define NAND_FTL_WEAR_CHECK_ERASES   16     //Erases between two static wear levelling checks
+#define NAND_FTL_GC_PERIOD           (50 * 10000)  //50ms, in 100ns units
+
+//Command sequences run at this TPL, so the FTL garbage collection timer
+//cannot interleave its cycles with a raw BlockIo transfer.
+#define NAND_TPL                     TPL_CALLBACK
+
+
+typedef struct {
+  UINT8 ManufactureId;
+  UINT8 DeviceId;
+  UINT8 BlockAddressStart; //Start of the Block address in actual NAND
+  UINT8 PageAddressStart;  //Start of the Page address in actual NAND
+  UINT8 Features;
+  UINT16 BlockCount;
+} NAND_PART_INFO_TABLE;
+
+typedef struct {
+  UINT8     ManufactureId;
+  UINT8     DeviceId;
+  UINT8     Organization;      //x8 or x16
+  UINT32    PageSize;
+  UINT32    SparePageSize;
+  UINT32    BlockSize;
+  UINT32    NumPagesPerBlock;
+  UINT32    BlockCount;
+  UINT8     BlockAddressStart; //Start of the Block address in actual NAND
+  UINT8     PageAddressStart;  //Start of the Page address in actual NAND
+  UINT8     ColumnAddressCycles;
+  UINT8     RowAddressCycles;
+  UINT8     PlaneCount;        //Adjacent blocks sit in different planes
+  BOOLEAN   ReadCache;         //Sequential cache reads (31h/3Fh) are used
+} NAND_FLASH_INFO;
+
+#pragma pack(1)
+//ONFI 1.0 parameter page, only the fields used by the driver are named.
+typedef struct {
+  UINT32    Signature;
+  UINT16    Revision;
+  UINT16    Features;
+  UINT16    OptionalCommands;
+  UINT8     Reserved0[22];
+  UINT8     Manufacturer[12];
+  UINT8     Model[20];
+  UINT8     Reserved1[16];
+  UINT32    DataBytesPerPage;
+  UINT16    SpareBytesPerPage;
+  UINT32    DataBytesPerPartialPage;
+  UINT16    SpareBytesPerPartialPage;
+  UINT32    PagesPerBlock;
+  UINT32    BlocksPerLun;
+  UINT8     NumberOfLuns;
+  UINT8     AddressCycles;     //Row cycles in bits 3:0, column cycles in bits 7:4
+  UINT8     Reserved2[11];
+  UINT8     InterleavedAddressBits;
+  UINT8     Reserved3[140];
+  UINT16    Crc;
+} ONFI_PARAMETER_PAGE;
+#pragma pack()
+
+typedef struct {
+  UINTN     CorrectedBits;       //Single-bit errors fixed in data or ECC
+  UINTN     UncorrectableChunks; //512-byte chunks with multi-bit errors
+} NAND_ECC_STATISTICS;
+
+typedef struct {
+  UINT32    Signature;
+  UINT32    Sequence;                                 //Highest sequence is the current table
+  UINT32    BlockCount;
+  UINT32    Checksum;                                 //32-bit sum of the structure is zero
+  UINT8     Bitmap[NAND_MAX_BLOCK_COUNT / 8];         //Set bit marks a bad block
+  UINT16    Replacement[NAND_BBT_RESERVED_BLOCKS];    //Block replaced by each reserved block
+} NAND_BBT;
+
+typedef enum {
+  NandFtlBlockFree,
+  NandFtlBlockActive,
+  NandFtlBlockUsed,
+  NandFtlBlockBad
+} NAND_FTL_BLOCK_STATE;
+
+#pragma pack(1)
+//Stored in the spare area of every page written through the FTL.
+typedef struct {
+  UINT16    Signature;
+  UINT16    Checksum;          //16-bit sum of the structure is zero
+  UINT32    LogicalSector;
+  UINT32    Sequence;          //Highest sequence wins when rebuilding the map
+  UINT32    EraseCount;        //Erase count of the block holding the page
+} NAND_FTL_PAGE_METADATA;
+#pragma pack()
+
+typedef struct {
+  UINT32    EraseCount;
+  UINT16    ValidPages;
+  UINT16    WrittenPages;
+  UINT8     State;
+  BOOLEAN   Erased;            //Erased by the FTL or blank checked, free blocks only
+} NAND_FTL_BLOCK;
+
+typedef struct {
+  UINTN           StartBlock;    //First NAND block of the FTL region
+  UINTN           BlockCount;
+  UINTN           PagesPerBlock;
+  UINTN           LogicalSectors;
+  UINT32          *Map;          //Logical sector -> physical page in the region
+  UINT32          *ReverseMap;   //Physical page in the region -> logical sector
+  NAND_FTL_BLOCK  *Blocks;
+  UINTN           FreeBlocks;
+  UINTN           ActiveBlock;   //Receives host writes and garbage collection
+  UINTN           ColdBlock;     //Receives data moved by static wear levelling
+  UINTN           ErasesSinceWearCheck;
+  UINT32          Sequence;
+  UINT8           *PageBuffer;
+  UINT8           *SpareBuffer;
+  UINT8           *CheckBuffer;  //Blank checks, PageBuffer may hold a page being moved
+  EFI_EVENT       GcEvent;
+} NAND_FTL_INSTANCE;
+
+extern NAND_FLASH_INFO *gNandFlashInfo;
+extern UINTN           gNum512BytesChunks;
+extern BOOLEAN         gNandBbtEnabled;
+
+VOID
+NandSendCommand (
+  UINT8 Command
+  );
+
+VOID
+NandSendAddress (
+  UINT8 Address
+  );
+
+VOID
+NandClearReady (
+  VOID
+  );
+
+EFI_STATUS
+NandWaitForReady (
+  IN UINTN  TimeoutUs
+  );
+
+EFI_STATUS
+EFIAPI
+NandFlashReset (
+  IN EFI_BLOCK_IO_PROTOCOL          *This,
+  IN BOOLEAN                        ExtendedVerification
+  );
+
+EFI_STATUS
+NandReadPage (
+  IN  UINTN                         BlockIndex,
+  IN  UINTN                         PageIndex,
+  OUT VOID                          *Buffer,
+  OUT UINT8                         *SpareBuffer
+  );
+
+EFI_STATUS
+NandReadSpare (
+  IN  UINTN                         BlockIndex,
+  IN  UINTN                         PageIndex,
+  OUT UINT8                         *SpareBuffer
+  );
+
+EFI_STATUS
+NandWritePage (
+  IN  UINTN                         BlockIndex,
+  IN  UINTN                         PageIndex,
+  OUT VOID                          *Buffer,
+  IN  UINT8                         *SpareBuffer
+  );
+
+EFI_STATUS
+NandEraseBlock (
+  IN UINTN BlockIndex
+  );
+
+BOOLEAN
+NandIsBufferErased (
+  IN VOID                           *Buffer,
+  IN UINTN                          Size
+  );
+
+BOOLEAN
+NandIsBlockBad (
+  IN UINTN  BlockIndex
+  );
+
+UINTN
+NandTranslateBlock (
+  IN UINTN  BlockIndex
+  );
+
+EFI_STATUS
+NandReadFactoryMarker (
+  IN  UINTN                         BlockIndex,
+  IN  UINT8                         *SpareBuffer,
+  OUT BOOLEAN                       *Bad
+  );
+
+EFI_STATUS
+NandMarkBlockBad (
+  IN UINTN  BlockIndex
+  );
+
+UINTN
+NandReplaceBadBlock (
+  IN UINTN  BlockIndex
+  );
+
+EFI_STATUS
+NandOnfiDetect (
+  VOID
+  );
+
+EFI_STATUS
+NandBbtInitialize (
+  VOID
+  );
+
+EFI_STATUS
+NandFtlInitialize (
+  VOID
+  );
+
+BOOLEAN
+NandFtlOwnsBlocks (
+  IN UINTN  StartBlock,
+  IN UINTN  EndBlock
+  );
+
+#endif //FLASH_H
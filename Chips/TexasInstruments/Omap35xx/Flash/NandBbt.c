@@ -0,0 +1,472 @@
+/** @file
+  Bad block table for the OMAP NAND driver.
+
+  The factory bad block markers are scanned once and the result is stored
+  in one of the NAND_BBT_BLOCKS blocks at the end of the part, so later
+  boots only read the table back. Bad blocks of the user area are replaced
+  by blocks of the reserved pool, which keeps block numbers seen through
+  BlockIo stable.
+
+  The table and the pool take the last blocks of the part away from BlockIo,
+  which moves the end of the raw NAND layout. They are only used when
+  PcdOmap35xxNandBbt is set, and only if those blocks are found unused.
+  Otherwise blocks are used in place, as other boot stages expect.
+
+  This program and the accompanying materials
+  are licensed and made available under the terms and conditions of the BSD License
+  which accompanies this distribution.  The full text of the license may be found at
+  http://opensource.org/licenses/bsd-license.php
+
+  THE PROGRAM IS DISTRIBUTED UNDER THE BSD LICENSE ON AN "AS IS" BASIS,
+  WITHOUT WARRANTIES OR REPRESENTATIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED.
+
+**/
+
+#include "Flash.h"
+
+NAND_BBT *gNandBbt = NULL;
+UINTN    gNandBbtBlock = NAND_BBT_NO_BLOCK;
+BOOLEAN  gNandBbtEnabled = FALSE;
+
+BOOLEAN
+NandIsBlockBad (
+  IN UINTN  BlockIndex
+  )
+{
+  return ((gNandBbt->Bitmap[BlockIndex / 8] & (1 << (BlockIndex % 8))) != 0);
+}
+
+VOID
+NandSetBlockBad (
+  IN UINTN  BlockIndex
+  )
+{
+  gNandBbt->Bitmap[BlockIndex / 8] |= (UINT8)(1 << (BlockIndex % 8));
+}
+
+//Return the block that holds the data of a user area block.
+UINTN
+NandTranslateBlock (
+  IN UINTN  BlockIndex
+  )
+{
+  UINTN Slot;
+
+  if (!gNandBbtEnabled || !NandIsBlockBad(BlockIndex)) {
+    return BlockIndex;
+  }
+
+  for (Slot = 0; Slot < NAND_BBT_RESERVED_BLOCKS; Slot++) {
+    if (gNandBbt->Replacement[Slot] == BlockIndex) {
+      return NAND_BBT_FIRST_RESERVED_BLOCK + Slot;
+    }
+  }
+
+  return NAND_BBT_NO_BLOCK;
+}
+
+//Assign a free reserved block to a bad user area block.
+UINTN
+NandAllocateReplacement (
+  IN UINTN  BlockIndex
+  )
+{
+  UINTN Slot;
+
+  for (Slot = 0; Slot < NAND_BBT_RESERVED_BLOCKS; Slot++) {
+    if (gNandBbt->Replacement[Slot] == NAND_BBT_SLOT_FREE) {
+      gNandBbt->Replacement[Slot] = (UINT16)BlockIndex;
+      return NAND_BBT_FIRST_RESERVED_BLOCK + Slot;
+    }
+  }
+
+  DEBUG ((EFI_D_ERROR, "No replacement left for bad Block: %d\n", BlockIndex));
+  return NAND_BBT_NO_BLOCK;
+}
+
+EFI_STATUS
+NandBbtSave (
+  VOID
+  )
+{
+  UINT8      *Buffer;
+  UINT8      *SpareBuffer;
+  UINTN      Index;
+  UINTN      Block;
+  EFI_STATUS Status = EFI_DEVICE_ERROR;
+
+  Buffer = (UINT8 *)AllocatePool(gNandFlashInfo->PageSize);
+  SpareBuffer = (UINT8 *)AllocatePool(gNandFlashInfo->SparePageSize);
+  if ((Buffer == NULL) || (SpareBuffer == NULL)) {
+    Status = EFI_OUT_OF_RESOURCES;
+    goto exit;
+  }
+
+  gNandBbt->Sequence++;
+
+  //Write the new table to the block after the current one, so the previous
+  //table survives an interrupted update.
+  for (Index = 1; Index <= NAND_BBT_BLOCKS; Index++) {
+    if (gNandBbtBlock == NAND_BBT_NO_BLOCK) {
+      Block = NAND_BBT_FIRST_BLOCK + (Index - 1);
+    } else {
+      Block = NAND_BBT_FIRST_BLOCK + ((gNandBbtBlock - NAND_BBT_FIRST_BLOCK + Index) % NAND_BBT_BLOCKS);
+    }
+
+    if (NandIsBlockBad(Block)) {
+      continue;
+    }
+
+    gNandBbt->Checksum = 0;
+    gNandBbt->Checksum = CalculateCheckSum32 ((UINT32 *)gNandBbt, sizeof(NAND_BBT));
+
+    SetMem(Buffer, gNandFlashInfo->PageSize, 0xFF);
+    CopyMem(Buffer, gNandBbt, sizeof(NAND_BBT));
+    SetMem(SpareBuffer, gNandFlashInfo->SparePageSize, 0xFF);
+
+    Status = NandEraseBlock(Block);
+    if (!EFI_ERROR(Status)) {
+      Status = NandWritePage(Block, 0, Buffer, SpareBuffer);
+    }
+
+    if (!EFI_ERROR(Status)) {
+      gNandBbtBlock = Block;
+      break;
+    }
+
+    if (Status == EFI_DEVICE_ERROR) {
+      NandSetBlockBad(Block);
+    }
+  }
+
+exit:
+  if (EFI_ERROR(Status)) {
+    DEBUG ((EFI_D_ERROR, "Bad block table update failed: %x\n", Status));
+  }
+
+  if (Buffer != NULL) {
+    FreePool(Buffer);
+  }
+
+  if (SpareBuffer != NULL) {
+    FreePool(SpareBuffer);
+  }
+
+  return Status;
+}
+
+//Mark a block bad without assigning a replacement. Used for blocks that are
+//managed elsewhere, like the flash translation layer region.
+EFI_STATUS
+NandMarkBlockBad (
+  IN UINTN  BlockIndex
+  )
+{
+  if (NandIsBlockBad(BlockIndex)) {
+    return EFI_SUCCESS;
+  }
+
+  NandSetBlockBad(BlockIndex);
+
+  //Without a table the block is only skipped for this boot.
+  if (!gNandBbtEnabled) {
+    return EFI_SUCCESS;
+  }
+
+  return NandBbtSave();
+}
+
+//Retire the block currently holding a user area block and return a new
+//block for it, or NAND_BBT_NO_BLOCK if the reserved pool is exhausted.
+UINTN
+NandReplaceBadBlock (
+  IN UINTN  BlockIndex
+  )
+{
+  UINTN Slot;
+  UINTN Replacement;
+
+  if (!gNandBbtEnabled) {
+    return NAND_BBT_NO_BLOCK;
+  }
+
+  DEBUG ((EFI_D_ERROR, "Replacing bad Block: %d\n", BlockIndex));
+
+  if (NandIsBlockBad(BlockIndex)) {
+    //The replacement itself went bad.
+    for (Slot = 0; Slot < NAND_BBT_RESERVED_BLOCKS; Slot++) {
+      if (gNandBbt->Replacement[Slot] == BlockIndex) {
+        gNandBbt->Replacement[Slot] = NAND_BBT_SLOT_BAD;
+        NandSetBlockBad(NAND_BBT_FIRST_RESERVED_BLOCK + Slot);
+      }
+    }
+  } else {
+    NandSetBlockBad(BlockIndex);
+  }
+
+  Replacement = NandAllocateReplacement(BlockIndex);
+
+  NandBbtSave();
+
+  return Replacement;
+}
+
+//Read the factory bad block markers of a block. A read that keeps failing
+//says nothing about the block, it is reported as an error and not as bad.
+EFI_STATUS
+NandReadFactoryMarker (
+  IN  UINTN    BlockIndex,
+  IN  UINT8    *SpareBuffer,
+  OUT BOOLEAN  *Bad
+  )
+{
+  UINTN      PageIndex;
+  UINTN      Retry;
+  EFI_STATUS Status;
+
+  *Bad = FALSE;
+
+  for (PageIndex = 0; PageIndex < BAD_BLOCK_MARKER_PAGES; PageIndex++) {
+    for (Retry = 0; Retry < NAND_BBT_READ_RETRIES; Retry++) {
+      Status = NandReadSpare(BlockIndex, PageIndex, SpareBuffer);
+      if (!EFI_ERROR(Status)) {
+        break;
+      }
+      NandFlashReset(NULL, TRUE);
+    }
+
+    if (EFI_ERROR(Status)) {
+      DEBUG ((EFI_D_ERROR, "Bad block marker read failed for Block: %d\n", BlockIndex));
+      return Status;
+    }
+
+    if (SpareBuffer[BAD_BLOCK_MARKER_POSITION] != 0xFF) {
+      *Bad = TRUE;
+    }
+
+    if ((gNandFlashInfo->Organization == ORGANIZATION_X16) && (SpareBuffer[BAD_BLOCK_MARKER_POSITION + 1] != 0xFF)) {
+      *Bad = TRUE;
+    }
+
+    if (*Bad) {
+      break;
+    }
+  }
+
+  return EFI_SUCCESS;
+}
+
+//The table and the reserved pool are only laid out over blocks that hold
+//nothing: erased, or an earlier table the load did not accept.
+BOOLEAN
+NandBbtIsAreaUnused (
+  VOID
+  )
+{
+  UINT8      *Buffer;
+  UINT8      *SpareBuffer;
+  UINTN      Block;
+  UINTN      PageIndex;
+  BOOLEAN    Unused = FALSE;
+  EFI_STATUS Status;
+
+  Buffer = (UINT8 *)AllocatePool(gNandFlashInfo->PageSize);
+  SpareBuffer = (UINT8 *)AllocatePool(gNandFlashInfo->SparePageSize);
+  if ((Buffer == NULL) || (SpareBuffer == NULL)) {
+    goto exit;
+  }
+
+  for (Block = NAND_BBT_FIRST_RESERVED_BLOCK; Block < gNandFlashInfo->BlockCount; Block++) {
+    if (NandIsBlockBad(Block)) {
+      continue;
+    }
+
+    for (PageIndex = 0; PageIndex < gNandFlashInfo->NumPagesPerBlock; PageIndex++) {
+      Status = NandReadPage(Block, PageIndex, Buffer, SpareBuffer);
+      if (EFI_ERROR(Status)) {
+        DEBUG ((EFI_D_ERROR, "Block: %d cannot be read, bad block table not created\n", Block));
+        goto exit;
+      }
+
+      if (NandIsBufferErased(Buffer, gNandFlashInfo->PageSize) &&
+          NandIsBufferErased(SpareBuffer, gNandFlashInfo->SparePageSize)) {
+        continue;
+      }
+
+      if ((Block >= NAND_BBT_FIRST_BLOCK) && (PageIndex == 0) && (((NAND_BBT *)Buffer)->Signature == NAND_BBT_SIGNATURE)) {
+        continue;
+      }
+
+      DEBUG ((EFI_D_ERROR, "Block: %d is in use, bad block table not created\n", Block));
+      goto exit;
+    }
+  }
+
+  Unused = TRUE;
+
+exit:
+  if (Buffer != NULL) {
+    FreePool(Buffer);
+  }
+
+  if (SpareBuffer != NULL) {
+    FreePool(SpareBuffer);
+  }
+
+  return Unused;
+}
+
+//Full scan of the factory bad block markers. Only done when no table is
+//found on the part.
+EFI_STATUS
+NandBbtScan (
+  VOID
+  )
+{
+  UINT8      *SpareBuffer;
+  UINTN      BlockIndex;
+  UINTN      Slot;
+  BOOLEAN    Bad;
+  BOOLEAN    Complete = TRUE;
+  EFI_STATUS Status;
+
+  SpareBuffer = (UINT8 *)AllocatePool(gNandFlashInfo->SparePageSize);
+  if (SpareBuffer == NULL) {
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  DEBUG ((EFI_D_INFO, "Scanning for bad blocks\n"));
+
+  for (BlockIndex = 0; BlockIndex < gNandFlashInfo->BlockCount; BlockIndex++) {
+    if (EFI_ERROR(NandReadFactoryMarker(BlockIndex, SpareBuffer, &Bad))) {
+      Complete = FALSE;
+    } else if (Bad) {
+      NandSetBlockBad(BlockIndex);
+    }
+  }
+
+  FreePool(SpareBuffer);
+
+  if (!NandBbtIsAreaUnused()) {
+    //Blocks are used in place, the bitmap is kept for the FTL.
+    gNandBbtEnabled = FALSE;
+    return EFI_ACCESS_DENIED;
+  }
+
+  //Blocks are only remapped through a table that is on the part. A block whose
+  //markers could not be read is used in place for this boot and the scan is
+  //repeated on the next one.
+  if (!Complete) {
+    DEBUG ((EFI_D_ERROR, "Bad block scan incomplete, bad block table not used\n"));
+    gNandBbtEnabled = FALSE;
+    return EFI_NOT_READY;
+  }
+
+  for (Slot = 0; Slot < NAND_BBT_RESERVED_BLOCKS; Slot++) {
+    if (NandIsBlockBad(NAND_BBT_FIRST_RESERVED_BLOCK + Slot)) {
+      gNandBbt->Replacement[Slot] = NAND_BBT_SLOT_BAD;
+    }
+  }
+
+  for (BlockIndex = 0; BlockIndex < NAND_BBT_FIRST_RESERVED_BLOCK; BlockIndex++) {
+    if (NandIsBlockBad(BlockIndex)) {
+      NandAllocateReplacement(BlockIndex);
+    }
+  }
+
+  Status = NandBbtSave();
+  if (EFI_ERROR(Status)) {
+    gNandBbtEnabled = FALSE;
+  }
+
+  return Status;
+}
+
+//Find the most recent valid table in the table blocks.
+EFI_STATUS
+NandBbtLoad (
+  VOID
+  )
+{
+  UINT8      *Buffer;
+  UINT8      *SpareBuffer;
+  NAND_BBT   *Bbt;
+  UINTN      Block;
+  EFI_STATUS Status;
+
+  Buffer = (UINT8 *)AllocatePool(gNandFlashInfo->PageSize);
+  SpareBuffer = (UINT8 *)AllocatePool(gNandFlashInfo->SparePageSize);
+  if ((Buffer == NULL) || (SpareBuffer == NULL)) {
+    Status = EFI_OUT_OF_RESOURCES;
+    goto exit;
+  }
+
+  Bbt = (NAND_BBT *)Buffer;
+  Status = EFI_NOT_FOUND;
+
+  for (Block = NAND_BBT_FIRST_BLOCK; Block < gNandFlashInfo->BlockCount; Block++) {
+    if (EFI_ERROR(NandReadPage(Block, 0, Buffer, SpareBuffer))) {
+      continue;
+    }
+
+    if ((Bbt->Signature != NAND_BBT_SIGNATURE) || (Bbt->BlockCount != gNandFlashInfo->BlockCount)) {
+      continue;
+    }
+
+    if (CalculateSum32 ((UINT32 *)Bbt, sizeof(NAND_BBT)) != 0) {
+      continue;
+    }
+
+    if ((gNandBbtBlock == NAND_BBT_NO_BLOCK) || (Bbt->Sequence > gNandBbt->Sequence)) {
+      CopyMem(gNandBbt, Bbt, sizeof(NAND_BBT));
+      gNandBbtBlock = Block;
+      Status = EFI_SUCCESS;
+    }
+  }
+
+exit:
+  if (Buffer != NULL) {
+    FreePool(Buffer);
+  }
+
+  if (SpareBuffer != NULL) {
+    FreePool(SpareBuffer);
+  }
+
+  return Status;
+}
+
+EFI_STATUS
+NandBbtInitialize (
+  VOID
+  )
+{
+  EFI_STATUS Status;
+
+  ASSERT (sizeof(NAND_BBT) <= gNandFlashInfo->PageSize);
+
+  gNandBbt = (NAND_BBT *)AllocateZeroPool(sizeof(NAND_BBT));
+  if (gNandBbt == NULL) {
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  //Without the table the bitmap only holds blocks retired during this boot.
+  if (!FeaturePcdGet(PcdOmap35xxNandBbt)) {
+    return EFI_SUCCESS;
+  }
+
+  gNandBbtEnabled = TRUE;
+
+  Status = NandBbtLoad();
+  if (Status == EFI_NOT_FOUND) {
+    gNandBbt->Signature = NAND_BBT_SIGNATURE;
+    gNandBbt->BlockCount = gNandFlashInfo->BlockCount;
+    SetMem16(gNandBbt->Replacement, sizeof(gNandBbt->Replacement), NAND_BBT_SLOT_FREE);
+
+    //Without a saved table the blocks are used in place for this boot.
+    NandBbtScan();
+    Status = EFI_SUCCESS;
+  }
+
+  return Status;
+}
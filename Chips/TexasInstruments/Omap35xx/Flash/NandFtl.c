@@ -0,0 +1,789 @@
+/** @file
+  Page mapped flash translation layer on top of the OMAP NAND driver.
+
+  Logical sectors are one NAND page in size and are written log-structured
+  into an active block. Every page carries its logical sector number and a
+  write sequence number in the spare area, so the mapping table is rebuilt
+  at boot by scanning the spare areas of the FTL region.
+
+  This program and the accompanying materials
+  are licensed and made available under the terms and conditions of the BSD License
+  which accompanies this distribution.  The full text of the license may be found at
+  http://opensource.org/licenses/bsd-license.php
+
+  THE PROGRAM IS DISTRIBUTED UNDER THE BSD LICENSE ON AN "AS IS" BASIS,
+  WITHOUT WARRANTIES OR REPRESENTATIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED.
+
+**/
+
+#include "Flash.h"
+
+NAND_FTL_INSTANCE *gNandFtl = NULL;
+
+typedef struct {
+  VENDOR_DEVICE_PATH        Guid;
+  EFI_DEVICE_PATH_PROTOCOL  End;
+} NAND_FTL_DEVICE_PATH;
+
+NAND_FTL_DEVICE_PATH gNandFtlDevicePath = {
+  {
+    { HARDWARE_DEVICE_PATH, HW_VENDOR_DP, { sizeof (VENDOR_DEVICE_PATH), 0 } },
+    { 0x6f3a2c1e, 0x8b4d, 0x4e55, { 0x9a, 0x1c, 0x3d, 0x52, 0x7e, 0x0b, 0x64, 0xf1 } }
+  },
+  { END_DEVICE_PATH_TYPE, END_ENTIRE_DEVICE_PATH_SUBTYPE, { sizeof (EFI_DEVICE_PATH_PROTOCOL), 0} }
+};
+
+BOOLEAN
+NandFtlIsMetadataValid (
+  IN NAND_FTL_PAGE_METADATA *Metadata
+  )
+{
+  if (Metadata->Signature != NAND_FTL_SIGNATURE) {
+    return FALSE;
+  }
+
+  return (CalculateSum16 ((UINT16 *)Metadata, sizeof (NAND_FTL_PAGE_METADATA)) == 0);
+}
+
+EFI_STATUS
+NandFtlEraseBlock (
+  IN UINTN  Block
+  )
+{
+  NAND_FTL_BLOCK *FtlBlock = &gNandFtl->Blocks[Block];
+  EFI_STATUS     Status;
+
+  ASSERT (FtlBlock->ValidPages == 0);
+
+  Status = NandEraseBlock (gNandFtl->StartBlock + Block);
+  if (EFI_ERROR (Status)) {
+    //Retire the block, it is never used again.
+    DEBUG ((EFI_D_ERROR, "Nand FTL retiring Block: %d\n", gNandFtl->StartBlock + Block));
+    FtlBlock->State = NandFtlBlockBad;
+    if (Status == EFI_DEVICE_ERROR) {
+      NandMarkBlockBad (gNandFtl->StartBlock + Block);
+    }
+    return Status;
+  }
+
+  FtlBlock->EraseCount++;
+  gNandFtl->ErasesSinceWearCheck++;
+  FtlBlock->WrittenPages = 0;
+  FtlBlock->State = NandFtlBlockFree;
+  FtlBlock->Erased = TRUE;
+  gNandFtl->FreeBlocks++;
+
+  return EFI_SUCCESS;
+}
+
+BOOLEAN
+NandFtlIsBlockErased (
+  IN UINTN  Block
+  )
+{
+  UINTN      Page;
+  EFI_STATUS Status;
+
+  for (Page = 0; Page < gNandFtl->PagesPerBlock; Page++) {
+    Status = NandReadPage (gNandFtl->StartBlock + Block, Page, gNandFtl->CheckBuffer, gNandFtl->SpareBuffer);
+    if (EFI_ERROR (Status) ||
+        !NandIsBufferErased (gNandFtl->CheckBuffer, gNandFlashInfo->PageSize) ||
+        !NandIsBufferErased (gNandFtl->SpareBuffer, gNandFlashInfo->SparePageSize)) {
+      return FALSE;
+    }
+  }
+
+  return TRUE;
+}
+
+//A free block found at mount only has an erased first page, the later
+//pages may still hold data of another owner of the region. Such blocks are
+//checked before their first page is programmed and erased if needed.
+EFI_STATUS
+NandFtlPrepareBlock (
+  IN UINTN  Block
+  )
+{
+  NAND_FTL_BLOCK *FtlBlock = &gNandFtl->Blocks[Block];
+
+  if (FtlBlock->Erased || NandFtlIsBlockErased (Block)) {
+    FtlBlock->Erased = TRUE;
+    return EFI_SUCCESS;
+  }
+
+  gNandFtl->FreeBlocks--;
+  return NandFtlEraseBlock (Block);
+}
+
+//Dynamic wear levelling: new data goes to the least worn free block. Cold
+//data moved by static wear levelling goes to the most worn one, where it is
+//unlikely to be rewritten soon.
+EFI_STATUS
+NandFtlOpenBlock (
+  IN BOOLEAN  Cold
+  )
+{
+  UINTN  Block;
+  UINTN  Best;
+  UINTN  *StreamBlock;
+
+  StreamBlock = Cold ? &gNandFtl->ColdBlock : &gNandFtl->ActiveBlock;
+
+  do {
+    Best = NAND_FTL_NO_BLOCK;
+    for (Block = 0; Block < gNandFtl->BlockCount; Block++) {
+      if (gNandFtl->Blocks[Block].State != NandFtlBlockFree) {
+        continue;
+      }
+      if ((Best == NAND_FTL_NO_BLOCK) ||
+          (!Cold && (gNandFtl->Blocks[Block].EraseCount < gNandFtl->Blocks[Best].EraseCount)) ||
+          (Cold && (gNandFtl->Blocks[Block].EraseCount > gNandFtl->Blocks[Best].EraseCount))) {
+        Best = Block;
+      }
+    }
+
+    if (Best == NAND_FTL_NO_BLOCK) {
+      return EFI_OUT_OF_RESOURCES;
+    }
+
+    //A block that cannot be erased is retired, try the next one.
+  } while (EFI_ERROR (NandFtlPrepareBlock (Best)));
+
+  gNandFtl->Blocks[Best].State = NandFtlBlockActive;
+  gNandFtl->FreeBlocks--;
+  *StreamBlock = Best;
+
+  return EFI_SUCCESS;
+}
+
+//Append one logical sector to the active or cold block and update the mapping.
+EFI_STATUS
+NandFtlProgramSector (
+  IN UINT32  LogicalSector,
+  IN VOID    *Buffer,
+  IN BOOLEAN Cold
+  )
+{
+  NAND_FTL_PAGE_METADATA *Metadata;
+  NAND_FTL_BLOCK         *FtlBlock;
+  UINTN                  *StreamBlock;
+  UINTN                  Block;
+  UINTN                  Page;
+  UINT32                 Physical;
+  UINT32                 OldPhysical;
+  EFI_STATUS             Status;
+
+  StreamBlock = Cold ? &gNandFtl->ColdBlock : &gNandFtl->ActiveBlock;
+
+  do {
+    if ((*StreamBlock == NAND_FTL_NO_BLOCK) ||
+        (gNandFtl->Blocks[*StreamBlock].WrittenPages == gNandFtl->PagesPerBlock)) {
+      if (*StreamBlock != NAND_FTL_NO_BLOCK) {
+        gNandFtl->Blocks[*StreamBlock].State = NandFtlBlockUsed;
+        *StreamBlock = NAND_FTL_NO_BLOCK;
+      }
+
+      Status = NandFtlOpenBlock (Cold);
+      if (EFI_ERROR (Status)) {
+        return Status;
+      }
+    }
+
+    Block = *StreamBlock;
+    FtlBlock = &gNandFtl->Blocks[Block];
+    Page = FtlBlock->WrittenPages++;
+
+    SetMem (gNandFtl->SpareBuffer, gNandFlashInfo->SparePageSize, 0xFF);
+    Metadata = (NAND_FTL_PAGE_METADATA *)&gNandFtl->SpareBuffer[NAND_FTL_SPARE_POSITION];
+    Metadata->Signature = NAND_FTL_SIGNATURE;
+    Metadata->Checksum = 0;
+    Metadata->LogicalSector = LogicalSector;
+    Metadata->Sequence = ++gNandFtl->Sequence;
+    Metadata->EraseCount = FtlBlock->EraseCount;
+    Metadata->Checksum = CalculateCheckSum16 ((UINT16 *)Metadata, sizeof (NAND_FTL_PAGE_METADATA));
+
+    Status = NandWritePage (gNandFtl->StartBlock + Block, Page, Buffer, gNandFtl->SpareBuffer);
+    if (EFI_ERROR (Status)) {
+      //Close the block and retry in a fresh one. Garbage collection moves
+      //whatever is still valid in it and retires it if the erase fails.
+      FtlBlock->WrittenPages = (UINT16)gNandFtl->PagesPerBlock;
+    }
+  } while (EFI_ERROR (Status));
+
+  Physical = (UINT32)(Block * gNandFtl->PagesPerBlock + Page);
+
+  OldPhysical = gNandFtl->Map[LogicalSector];
+  if (OldPhysical != NAND_FTL_UNMAPPED) {
+    gNandFtl->ReverseMap[OldPhysical] = NAND_FTL_UNMAPPED;
+    gNandFtl->Blocks[OldPhysical / gNandFtl->PagesPerBlock].ValidPages--;
+  }
+
+  gNandFtl->Map[LogicalSector] = Physical;
+  gNandFtl->ReverseMap[Physical] = LogicalSector;
+  FtlBlock->ValidPages++;
+
+  return EFI_SUCCESS;
+}
+
+//Move the valid pages of a block to the active or cold block and erase it.
+EFI_STATUS
+NandFtlReclaimBlock (
+  IN UINTN    Block,
+  IN BOOLEAN  Cold
+  )
+{
+  UINTN      Page;
+  UINT32     LogicalSector;
+  EFI_STATUS Status;
+
+  for (Page = 0; Page < gNandFtl->Blocks[Block].WrittenPages; Page++) {
+    LogicalSector = gNandFtl->ReverseMap[Block * gNandFtl->PagesPerBlock + Page];
+    if (LogicalSector == NAND_FTL_UNMAPPED) {
+      continue;
+    }
+
+    Status = NandReadPage (gNandFtl->StartBlock + Block, Page, gNandFtl->PageBuffer, gNandFtl->SpareBuffer);
+    if (EFI_ERROR (Status)) {
+      return Status;
+    }
+
+    Status = NandFtlProgramSector (LogicalSector, gNandFtl->PageBuffer, Cold);
+    if (EFI_ERROR (Status)) {
+      return Status;
+    }
+  }
+
+  return NandFtlEraseBlock (Block);
+}
+
+//Greedy victim selection: the used block with the fewest valid pages.
+UINTN
+NandFtlSelectVictim (
+  VOID
+  )
+{
+  UINTN          Block;
+  UINTN          Victim = NAND_FTL_NO_BLOCK;
+  NAND_FTL_BLOCK *FtlBlock;
+
+  for (Block = 0; Block < gNandFtl->BlockCount; Block++) {
+    FtlBlock = &gNandFtl->Blocks[Block];
+    if (FtlBlock->State != NandFtlBlockUsed) {
+      continue;
+    }
+    if ((Victim == NAND_FTL_NO_BLOCK) ||
+        (FtlBlock->ValidPages < gNandFtl->Blocks[Victim].ValidPages) ||
+        ((FtlBlock->ValidPages == gNandFtl->Blocks[Victim].ValidPages) &&
+         (FtlBlock->EraseCount < gNandFtl->Blocks[Victim].EraseCount))) {
+      Victim = Block;
+    }
+  }
+
+  if ((Victim != NAND_FTL_NO_BLOCK) && (gNandFtl->Blocks[Victim].ValidPages == gNandFtl->PagesPerBlock)) {
+    //Nothing to gain.
+    return NAND_FTL_NO_BLOCK;
+  }
+
+  return Victim;
+}
+
+//Static wear levelling: return the least worn used block when the erase
+//count spread is too large, so the cold data it holds is moved and the
+//block rejoins the free pool.
+UINTN
+NandFtlSelectColdBlock (
+  VOID
+  )
+{
+  UINTN          Block;
+  UINTN          Coldest = NAND_FTL_NO_BLOCK;
+  UINT32         MaxEraseCount = 0;
+  NAND_FTL_BLOCK *FtlBlock;
+
+  for (Block = 0; Block < gNandFtl->BlockCount; Block++) {
+    FtlBlock = &gNandFtl->Blocks[Block];
+    if (FtlBlock->State == NandFtlBlockBad) {
+      continue;
+    }
+
+    MaxEraseCount = MAX (MaxEraseCount, FtlBlock->EraseCount);
+
+    if ((FtlBlock->State == NandFtlBlockUsed) &&
+        ((Coldest == NAND_FTL_NO_BLOCK) || (FtlBlock->EraseCount < gNandFtl->Blocks[Coldest].EraseCount))) {
+      Coldest = Block;
+    }
+  }
+
+  if ((Coldest == NAND_FTL_NO_BLOCK) ||
+      ((MaxEraseCount - gNandFtl->Blocks[Coldest].EraseCount) < NAND_FTL_WEAR_THRESHOLD)) {
+    return NAND_FTL_NO_BLOCK;
+  }
+
+  return Coldest;
+}
+
+EFI_STATUS
+NandFtlCollectGarbage (
+  IN UINTN  MinFreeBlocks
+  )
+{
+  UINTN      Victim;
+  EFI_STATUS Status;
+
+  while (gNandFtl->FreeBlocks < MinFreeBlocks) {
+    Victim = NandFtlSelectVictim ();
+    if (Victim == NAND_FTL_NO_BLOCK) {
+      return EFI_VOLUME_FULL;
+    }
+
+    Status = NandFtlReclaimBlock (Victim, FALSE);
+    if (EFI_ERROR (Status) && (gNandFtl->Blocks[Victim].State != NandFtlBlockBad)) {
+      return Status;
+    }
+  }
+
+  return EFI_SUCCESS;
+}
+
+//Called from the write path once NAND_FTL_WEAR_CHECK_ERASES blocks have been
+//erased, so a device that is not written is never erased for levelling.
+VOID
+NandFtlLevelWear (
+  VOID
+  )
+{
+  UINTN Block;
+
+  gNandFtl->ErasesSinceWearCheck = 0;
+
+  //Levelling is deferred while space is short, the next erases retry it.
+  if (gNandFtl->FreeBlocks < NAND_FTL_GC_FREE_BLOCKS) {
+    return;
+  }
+
+  Block = NandFtlSelectColdBlock ();
+  if (Block != NAND_FTL_NO_BLOCK) {
+    NandFtlReclaimBlock (Block, TRUE);
+  }
+}
+
+//Runs from a timer at NAND_TPL. Both BlockIo instances raise to the same
+//TPL, so this never interleaves with a transfer. Reclaims at most one block
+//per tick to keep the callback short, and only while free blocks are short.
+VOID
+EFIAPI
+NandFtlBackgroundGc (
+  IN EFI_EVENT  Event,
+  IN VOID       *Context
+  )
+{
+  UINTN Block;
+
+  if (gNandFtl->FreeBlocks >= NAND_FTL_GC_FREE_BLOCKS) {
+    return;
+  }
+
+  Block = NandFtlSelectVictim ();
+  if (Block != NAND_FTL_NO_BLOCK) {
+    NandFtlReclaimBlock (Block, FALSE);
+  }
+}
+
+//Rebuild the mapping table from the spare area metadata.
+EFI_STATUS
+NandFtlMount (
+  VOID
+  )
+{
+  NAND_FTL_PAGE_METADATA *Metadata;
+  NAND_FTL_BLOCK         *FtlBlock;
+  UINT32                 *SequenceMap;
+  UINTN                  Block;
+  UINTN                  Page;
+  BOOLEAN                Bad;
+  UINT32                 Physical;
+  UINT32                 LogicalSector;
+  UINT64                 EraseCountSum = 0;
+  UINTN                  EraseCountBlocks = 0;
+  UINT32                 AverageEraseCount;
+  EFI_STATUS             Status;
+
+  SequenceMap = (UINT32 *)AllocateZeroPool (gNandFtl->LogicalSectors * sizeof (UINT32));
+  if (SequenceMap == NULL) {
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  Metadata = (NAND_FTL_PAGE_METADATA *)&gNandFtl->SpareBuffer[NAND_FTL_SPARE_POSITION];
+
+  for (Block = 0; Block < gNandFtl->BlockCount; Block++) {
+    FtlBlock = &gNandFtl->Blocks[Block];
+
+    //The FTL does its own bad block handling and ignores replacements.
+    if (NandIsBlockBad (gNandFtl->StartBlock + Block)) {
+      FtlBlock->State = NandFtlBlockBad;
+      continue;
+    }
+
+    //Without a bad block table the factory markers are checked here, a
+    //factory bad block must never be erased. Unreadable markers keep the
+    //block out of use for this boot.
+    if (!gNandBbtEnabled) {
+      Status = NandReadFactoryMarker (gNandFtl->StartBlock + Block, gNandFtl->SpareBuffer, &Bad);
+      if (EFI_ERROR (Status) || Bad) {
+        FtlBlock->State = NandFtlBlockBad;
+        continue;
+      }
+    }
+
+    //Pages are programmed in order, the first erased page ends the block.
+    for (Page = 0; Page < gNandFtl->PagesPerBlock; Page++) {
+      Status = NandReadSpare (gNandFtl->StartBlock + Block, Page, gNandFtl->SpareBuffer);
+      if (EFI_ERROR (Status)) {
+        //Treat the rest of the block as garbage.
+        Page = gNandFtl->PagesPerBlock;
+        break;
+      }
+
+      if (NandIsBufferErased (gNandFtl->SpareBuffer, gNandFlashInfo->SparePageSize)) {
+        break;
+      }
+
+      //Foreign data is left for garbage collection to erase.
+      if (!NandFtlIsMetadataValid (Metadata)) {
+        continue;
+      }
+
+      FtlBlock->EraseCount = MAX (FtlBlock->EraseCount, Metadata->EraseCount);
+      gNandFtl->Sequence = MAX (gNandFtl->Sequence, Metadata->Sequence);
+
+      LogicalSector = Metadata->LogicalSector;
+      if (LogicalSector >= gNandFtl->LogicalSectors) {
+        continue;
+      }
+
+      if ((gNandFtl->Map[LogicalSector] == NAND_FTL_UNMAPPED) || (Metadata->Sequence > SequenceMap[LogicalSector])) {
+        Physical = (UINT32)(Block * gNandFtl->PagesPerBlock + Page);
+        gNandFtl->Map[LogicalSector] = Physical;
+        SequenceMap[LogicalSector] = Metadata->Sequence;
+      }
+    }
+
+    //Partially written blocks are not appended to after a reboot, the last
+    //page may have been interrupted. Blocks with an erased first page are
+    //blank checked when they are opened.
+    if (Page == 0) {
+      FtlBlock->State = NandFtlBlockFree;
+      gNandFtl->FreeBlocks++;
+    } else {
+      FtlBlock->State = NandFtlBlockUsed;
+      FtlBlock->WrittenPages = (UINT16)Page;
+      EraseCountSum += FtlBlock->EraseCount;
+      EraseCountBlocks++;
+    }
+  }
+
+  FreePool (SequenceMap);
+
+  //Build the reverse map and valid page counts from the winning entries.
+  for (LogicalSector = 0; LogicalSector < gNandFtl->LogicalSectors; LogicalSector++) {
+    Physical = gNandFtl->Map[LogicalSector];
+    if (Physical != NAND_FTL_UNMAPPED) {
+      gNandFtl->ReverseMap[Physical] = LogicalSector;
+      gNandFtl->Blocks[Physical / gNandFtl->PagesPerBlock].ValidPages++;
+    }
+  }
+
+  //Erased blocks carry no metadata, assume they are as worn as the average.
+  AverageEraseCount = (EraseCountBlocks != 0) ? (UINT32)DivU64x32 (EraseCountSum, (UINT32)EraseCountBlocks) : 0;
+  for (Block = 0; Block < gNandFtl->BlockCount; Block++) {
+    if (gNandFtl->Blocks[Block].State == NandFtlBlockFree) {
+      gNandFtl->Blocks[Block].EraseCount = AverageEraseCount;
+    }
+  }
+
+  return EFI_SUCCESS;
+}
+
+EFI_STATUS
+EFIAPI
+NandFtlReset (
+  IN EFI_BLOCK_IO_PROTOCOL          *This,
+  IN BOOLEAN                        ExtendedVerification
+  )
+{
+  return NandFlashReset (This, ExtendedVerification);
+}
+
+EFI_STATUS
+EFIAPI
+NandFtlReadBlocks (
+  IN EFI_BLOCK_IO_PROTOCOL          *This,
+  IN UINT32                         MediaId,
+  IN EFI_LBA                        Lba,
+  IN UINTN                          BufferSize,
+  OUT VOID                          *Buffer
+  )
+{
+  UINTN      NumSectors;
+  UINTN      Index;
+  UINT32     Physical;
+  EFI_TPL    OldTpl;
+  EFI_STATUS Status = EFI_SUCCESS;
+
+  if (Buffer == NULL) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  if ((BufferSize % gNandFlashInfo->PageSize) != 0) {
+    return EFI_BAD_BUFFER_SIZE;
+  }
+
+  NumSectors = BufferSize / gNandFlashInfo->PageSize;
+  if ((Lba >= gNandFtl->LogicalSectors) || (NumSectors > (gNandFtl->LogicalSectors - (UINTN)Lba))) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  OldTpl = gBS->RaiseTPL (NAND_TPL);
+
+  for (Index = 0; Index < NumSectors; Index++) {
+    Physical = gNandFtl->Map[(UINTN)Lba + Index];
+    if (Physical == NAND_FTL_UNMAPPED) {
+      //Never written.
+      SetMem (Buffer, gNandFlashInfo->PageSize, 0xFF);
+    } else {
+      Status = NandReadPage (gNandFtl->StartBlock + (Physical / gNandFtl->PagesPerBlock),
+                             Physical % gNandFtl->PagesPerBlock,
+                             Buffer,
+                             gNandFtl->SpareBuffer);
+      if (EFI_ERROR (Status)) {
+        break;
+      }
+    }
+    Buffer = ((UINT8 *)Buffer + gNandFlashInfo->PageSize);
+  }
+
+  gBS->RestoreTPL (OldTpl);
+
+  return Status;
+}
+
+EFI_STATUS
+EFIAPI
+NandFtlWriteBlocks (
+  IN EFI_BLOCK_IO_PROTOCOL          *This,
+  IN UINT32                         MediaId,
+  IN EFI_LBA                        Lba,
+  IN UINTN                          BufferSize,
+  IN VOID                           *Buffer
+  )
+{
+  UINTN      NumSectors;
+  UINTN      Index;
+  EFI_TPL    OldTpl;
+  EFI_STATUS Status = EFI_SUCCESS;
+
+  if (Buffer == NULL) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  if ((BufferSize % gNandFlashInfo->PageSize) != 0) {
+    return EFI_BAD_BUFFER_SIZE;
+  }
+
+  NumSectors = BufferSize / gNandFlashInfo->PageSize;
+  if ((Lba >= gNandFtl->LogicalSectors) || (NumSectors > (gNandFtl->LogicalSectors - (UINTN)Lba))) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  OldTpl = gBS->RaiseTPL (NAND_TPL);
+
+  for (Index = 0; Index < NumSectors; Index++) {
+    //Only reclaim in the write path when the active block is about to run out.
+    if ((gNandFtl->ActiveBlock == NAND_FTL_NO_BLOCK) ||
+        (gNandFtl->Blocks[gNandFtl->ActiveBlock].WrittenPages == gNandFtl->PagesPerBlock)) {
+      Status = NandFtlCollectGarbage (NAND_FTL_MIN_FREE_BLOCKS);
+      if (EFI_ERROR (Status)) {
+        break;
+      }
+    }
+
+    Status = NandFtlProgramSector ((UINT32)((UINTN)Lba + Index), Buffer, FALSE);
+    if (EFI_ERROR (Status)) {
+      break;
+    }
+    Buffer = ((UINT8 *)Buffer + gNandFlashInfo->PageSize);
+  }
+
+  if (!EFI_ERROR (Status) && (gNandFtl->ErasesSinceWearCheck >= NAND_FTL_WEAR_CHECK_ERASES)) {
+    NandFtlLevelWear ();
+  }
+
+  gBS->RestoreTPL (OldTpl);
+
+  if (EFI_ERROR (Status)) {
+    DEBUG ((EFI_D_ERROR, "Nand FTL write fails: %x\n", Status));
+  }
+
+  return Status;
+}
+
+EFI_STATUS
+EFIAPI
+NandFtlFlushBlocks (
+  IN EFI_BLOCK_IO_PROTOCOL  *This
+  )
+{
+  //Writes are not cached.
+  return EFI_SUCCESS;
+}
+
+EFI_BLOCK_IO_MEDIA gNandFtlMedia = {
+  SIGNATURE_32('n','f','t','l'),            // MediaId
+  FALSE,                                    // RemovableMedia
+  TRUE,                                     // MediaPresent
+  FALSE,                                    // LogicalPartition
+  FALSE,                                    // ReadOnly
+  FALSE,                                    // WriteCaching
+  0,                                        // BlockSize
+  4,                                        // IoAlign
+  0,                                        // Pad
+  0                                         // LastBlock
+};
+
+EFI_BLOCK_IO_PROTOCOL gNandFtlBlockIo =
+{
+  EFI_BLOCK_IO_INTERFACE_REVISION,  // Revision
+  &gNandFtlMedia,                   // *Media
+  NandFtlReset,                     // Reset
+  NandFtlReadBlocks,                // ReadBlocks
+  NandFtlWriteBlocks,               // WriteBlocks
+  NandFtlFlushBlocks                // FlushBlocks
+};
+
+EFI_STATUS
+NandFtlInitialize (
+  VOID
+  )
+{
+  EFI_STATUS  Status;
+  EFI_HANDLE  Handle = NULL;
+  UINTN       StartBlock = PcdGet32 (PcdOmap35xxNandFtlStartBlock);
+  UINTN       BlockCount = PcdGet32 (PcdOmap35xxNandFtlBlockCount);
+  UINTN       PhysicalPages;
+
+  if (BlockCount == 0) {
+    //No region assigned to the FTL.
+    return EFI_SUCCESS;
+  }
+
+  if ((StartBlock + BlockCount > LAST_BLOCK + 1) || (BlockCount <= NAND_FTL_RESERVED_BLOCKS (BlockCount))) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  //The page metadata has to fit behind the ECC bytes.
+  if (NAND_FTL_SPARE_POSITION + sizeof (NAND_FTL_PAGE_METADATA) > gNandFlashInfo->SparePageSize) {
+    return EFI_UNSUPPORTED;
+  }
+
+  gNandFtl = (NAND_FTL_INSTANCE *)AllocateZeroPool (sizeof (NAND_FTL_INSTANCE));
+  if (gNandFtl == NULL) {
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  gNandFtl->StartBlock = StartBlock;
+  gNandFtl->BlockCount = BlockCount;
+  gNandFtl->PagesPerBlock = gNandFlashInfo->NumPagesPerBlock;
+  gNandFtl->LogicalSectors = (BlockCount - NAND_FTL_RESERVED_BLOCKS (BlockCount)) * gNandFtl->PagesPerBlock;
+  gNandFtl->ActiveBlock = NAND_FTL_NO_BLOCK;
+  gNandFtl->ColdBlock = NAND_FTL_NO_BLOCK;
+  PhysicalPages = BlockCount * gNandFtl->PagesPerBlock;
+
+  gNandFtl->Map = (UINT32 *)AllocatePool (gNandFtl->LogicalSectors * sizeof (UINT32));
+  gNandFtl->ReverseMap = (UINT32 *)AllocatePool (PhysicalPages * sizeof (UINT32));
+  gNandFtl->Blocks = (NAND_FTL_BLOCK *)AllocateZeroPool (BlockCount * sizeof (NAND_FTL_BLOCK));
+  gNandFtl->PageBuffer = (UINT8 *)AllocatePool (gNandFlashInfo->PageSize);
+  gNandFtl->SpareBuffer = (UINT8 *)AllocatePool (gNandFlashInfo->SparePageSize);
+  gNandFtl->CheckBuffer = (UINT8 *)AllocatePool (gNandFlashInfo->PageSize);
+  if ((gNandFtl->Map == NULL) || (gNandFtl->ReverseMap == NULL) || (gNandFtl->Blocks == NULL) ||
+      (gNandFtl->PageBuffer == NULL) || (gNandFtl->SpareBuffer == NULL) || (gNandFtl->CheckBuffer == NULL)) {
+    Status = EFI_OUT_OF_RESOURCES;
+    goto exit;
+  }
+
+  SetMem32 (gNandFtl->Map, gNandFtl->LogicalSectors * sizeof (UINT32), NAND_FTL_UNMAPPED);
+  SetMem32 (gNandFtl->ReverseMap, PhysicalPages * sizeof (UINT32), NAND_FTL_UNMAPPED);
+
+  Status = NandFtlMount ();
+  if (EFI_ERROR (Status)) {
+    goto exit;
+  }
+
+  Status = gBS->CreateEvent (
+                  EVT_TIMER | EVT_NOTIFY_SIGNAL,
+                  NAND_TPL,
+                  NandFtlBackgroundGc,
+                  NULL,
+                  &gNandFtl->GcEvent
+                  );
+  if (EFI_ERROR (Status)) {
+    goto exit;
+  }
+
+  Status = gBS->SetTimer (gNandFtl->GcEvent, TimerPeriodic, NAND_FTL_GC_PERIOD);
+  if (EFI_ERROR (Status)) {
+    goto exit;
+  }
+
+  gNandFtlMedia.BlockSize = gNandFlashInfo->PageSize;
+  gNandFtlMedia.LastBlock = gNandFtl->LogicalSectors - 1;
+
+  Status = gBS->InstallMultipleProtocolInterfaces (
+                  &Handle,
+                  &gEfiBlockIoProtocolGuid, &gNandFtlBlockIo,
+                  &gEfiDevicePathProtocolGuid, &gNandFtlDevicePath,
+                  NULL
+                  );
+
+exit:
+  if (EFI_ERROR (Status)) {
+    if (gNandFtl->GcEvent != NULL) {
+      gBS->CloseEvent (gNandFtl->GcEvent);
+    }
+    if (gNandFtl->Map != NULL) {
+      FreePool (gNandFtl->Map);
+    }
+    if (gNandFtl->ReverseMap != NULL) {
+      FreePool (gNandFtl->ReverseMap);
+    }
+    if (gNandFtl->Blocks != NULL) {
+      FreePool (gNandFtl->Blocks);
+    }
+    if (gNandFtl->PageBuffer != NULL) {
+      FreePool (gNandFtl->PageBuffer);
+    }
+    if (gNandFtl->SpareBuffer != NULL) {
+      FreePool (gNandFtl->SpareBuffer);
+    }
+    if (gNandFtl->CheckBuffer != NULL) {
+      FreePool (gNandFtl->CheckBuffer);
+    }
+    FreePool (gNandFtl);
+    gNandFtl = NULL;
+  }
+
+  return Status;
+}
+
+//Raw BlockIo writes must not reach the blocks the FTL manages.
+BOOLEAN
+NandFtlOwnsBlocks (
+  IN UINTN  StartBlock,
+  IN UINTN  EndBlock
+  )
+{
+  if (gNandFtl == NULL) {
+    return FALSE;
+  }
+
+  return ((StartBlock < gNandFtl->StartBlock + gNandFtl->BlockCount) && (EndBlock >= gNandFtl->StartBlock));
+}
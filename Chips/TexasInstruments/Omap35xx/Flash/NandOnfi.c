@@ -0,0 +1,160 @@
+/** @file
+  ONFI parameter page support for the OMAP NAND driver.
+
+  Parts that answer READ ID at address 20h with "ONFI" describe their own
+  geometry in the parameter page, so they do not need an entry in the part
+  table.
+
+  This program and the accompanying materials
+  are licensed and made available under the terms and conditions of the BSD License
+  which accompanies this distribution.  The full text of the license may be found at
+  http://opensource.org/licenses/bsd-license.php
+
+  THE PROGRAM IS DISTRIBUTED UNDER THE BSD LICENSE ON AN "AS IS" BASIS,
+  WITHOUT WARRANTIES OR REPRESENTATIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED.
+
+**/
+
+#include "Flash.h"
+
+//CRC-16 of the parameter page, MSB first.
+UINT16
+NandOnfiCrc16 (
+  IN UINT8  *Buffer,
+  IN UINTN  Size
+  )
+{
+  UINT16 Crc = ONFI_CRC_SEED;
+  UINTN  Bit;
+
+  for (; Size; Size--) {
+    Crc ^= (UINT16)(*Buffer++ << 8);
+    for (Bit = 0; Bit < 8; Bit++) {
+      if (Crc & BIT15) {
+        Crc = (UINT16)((Crc << 1) ^ ONFI_CRC_POLYNOMIAL);
+      } else {
+        Crc = (UINT16)(Crc << 1);
+      }
+    }
+  }
+
+  return Crc;
+}
+
+BOOLEAN
+NandOnfiIsPresent (
+  VOID
+  )
+{
+  UINT32 Signature = 0;
+  UINTN  Index;
+
+  //Send READ ID command with the ONFI address.
+  NandSendCommand(READ_ID_CMD);
+  NandSendAddress(ONFI_ID_ADDRESS);
+
+  //Parameter and ID data is on the low byte of the bus on x16 parts.
+  for (Index = 0; Index < sizeof(Signature); Index++) {
+    Signature |= (UINT32)(MmioRead16(GPMC_NAND_DATA_0) & 0xFF) << (Index * 8);
+  }
+
+  return (Signature == ONFI_SIGNATURE);
+}
+
+EFI_STATUS
+NandOnfiReadParameterPage (
+  OUT ONFI_PARAMETER_PAGE  *ParameterPage
+  )
+{
+  UINT8      *Buffer = (UINT8 *)ParameterPage;
+  UINTN      Copy;
+  UINTN      Index;
+  EFI_STATUS Status;
+
+  NandSendCommand(READ_PARAMETER_PAGE_CMD);
+  NandClearReady();
+  NandSendAddress(0);
+
+  Status = NandWaitForReady(NAND_READ_TIMEOUT_US);
+  if (EFI_ERROR(Status)) {
+    return Status;
+  }
+
+  //The copies follow each other, use the first one with a good CRC.
+  for (Copy = 0; Copy < ONFI_PARAMETER_PAGE_COPIES; Copy++) {
+    for (Index = 0; Index < sizeof(ONFI_PARAMETER_PAGE); Index++) {
+      Buffer[Index] = (UINT8)MmioRead16(GPMC_NAND_DATA_0);
+    }
+
+    if ((ParameterPage->Signature == ONFI_SIGNATURE) &&
+        (NandOnfiCrc16(Buffer, OFFSET_OF(ONFI_PARAMETER_PAGE, Crc)) == ParameterPage->Crc)) {
+      return EFI_SUCCESS;
+    }
+  }
+
+  return EFI_CRC_ERROR;
+}
+
+//Fill gNandFlashInfo from the parameter page. Returns EFI_NOT_FOUND if the
+//part is not ONFI compliant.
+EFI_STATUS
+NandOnfiDetect (
+  VOID
+  )
+{
+  ONFI_PARAMETER_PAGE *ParameterPage;
+  EFI_STATUS          Status;
+
+  if (!NandOnfiIsPresent()) {
+    return EFI_NOT_FOUND;
+  }
+
+  ParameterPage = (ONFI_PARAMETER_PAGE *)AllocatePool(sizeof(ONFI_PARAMETER_PAGE));
+  if (ParameterPage == NULL) {
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  Status = NandOnfiReadParameterPage(ParameterPage);
+  if (EFI_ERROR(Status)) {
+    DEBUG ((EFI_D_ERROR, "ONFI parameter page read failed: %x\n", Status));
+    goto exit;
+  }
+
+  gNandFlashInfo->PageSize = ParameterPage->DataBytesPerPage;
+  gNandFlashInfo->SparePageSize = ParameterPage->SpareBytesPerPage;
+  gNandFlashInfo->NumPagesPerBlock = ParameterPage->PagesPerBlock;
+  gNandFlashInfo->BlockSize = ParameterPage->DataBytesPerPage * ParameterPage->PagesPerBlock;
+
+  //Blocks of the next LUN only follow on from the last block of a LUN when
+  //the LUN block count is a power of two, otherwise stay on the first LUN.
+  gNandFlashInfo->BlockCount = ParameterPage->BlocksPerLun;
+  if ((ParameterPage->BlocksPerLun & (ParameterPage->BlocksPerLun - 1)) == 0) {
+    gNandFlashInfo->BlockCount *= ParameterPage->NumberOfLuns;
+  }
+
+  if (ParameterPage->Features & ONFI_FEATURE_16BIT_BUS) {
+    gNandFlashInfo->Organization = ORGANIZATION_X16;
+  } else {
+    gNandFlashInfo->Organization = ORGANIZATION_X8;
+  }
+
+  gNandFlashInfo->ColumnAddressCycles = ParameterPage->AddressCycles >> 4;
+  gNandFlashInfo->RowAddressCycles = ParameterPage->AddressCycles & 0x0F;
+
+  if (ParameterPage->Features & ONFI_FEATURE_INTERLEAVED) {
+    gNandFlashInfo->PlaneCount = (UINT8)(1 << ParameterPage->InterleavedAddressBits);
+  } else {
+    gNandFlashInfo->PlaneCount = 1;
+  }
+
+  gNandFlashInfo->ReadCache = (ParameterPage->OptionalCommands & ONFI_COMMAND_READ_CACHE) != 0;
+
+  DEBUG ((EFI_D_INFO, "ONFI part: %d+%d byte pages, %d pages per block, %d blocks, %d planes\n",
+          gNandFlashInfo->PageSize, gNandFlashInfo->SparePageSize, gNandFlashInfo->NumPagesPerBlock,
+          gNandFlashInfo->BlockCount, gNandFlashInfo->PlaneCount));
+
+exit:
+  FreePool(ParameterPage);
+
+  return Status;
+}
@@ -0,0 +1,81 @@
+/** @file
+  Page flip protocol of the OMAP LCD graphics output driver.
+
+  Buffer 0 is the framebuffer of the Graphics Output Protocol. The other
+  buffers are carved from the same VRAM and have the layout of the current
+  GOP mode. A client renders into a buffer that is not displayed and flips
+  to it, the DSS switches to the new buffer at the next VSYNC so the screen
+  never shows a partly drawn frame.
+
+  The buffers are only valid until the next GOP SetMode, which also returns
+  the display to buffer 0.
+
+  This program and the accompanying materials
+  are licensed and made available under the terms and conditions of the BSD License
+  which accompanies this distribution.  The full text of the license may be found at
+  http://opensource.org/licenses/bsd-license.php
+
+  THE PROGRAM IS DISTRIBUTED UNDER THE BSD LICENSE ON AN "AS IS" BASIS,
+  WITHOUT WARRANTIES OR REPRESENTATIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED.
+
+**/
+
+#ifndef __OMAP_PAGE_FLIP_H__
+#define __OMAP_PAGE_FLIP_H__
+
+#define OMAP_PAGE_FLIP_PROTOCOL_GUID \
+  { 0xba355320, 0x725b, 0x495a, { 0xb4, 0x90, 0x03, 0x8e, 0x1d, 0xa5, 0x97, 0x12 } }
+
+typedef struct _OMAP_PAGE_FLIP_PROTOCOL OMAP_PAGE_FLIP_PROTOCOL;
+
+/**
+  Return the address of a buffer.
+
+  @param  This                  Pointer to the protocol instance.
+  @param  BufferIndex           Buffer to return, 0 is the GOP framebuffer.
+  @param  Address               Start of the buffer. It holds VerticalResolution lines
+                                of PixelsPerScanLine pixels of the current mode.
+
+  @retval EFI_SUCCESS           The address was returned.
+  @retval EFI_INVALID_PARAMETER BufferIndex is not below BufferCount.
+
+**/
+typedef
+EFI_STATUS
+(EFIAPI *OMAP_PAGE_FLIP_GET_BUFFER) (
+  IN  OMAP_PAGE_FLIP_PROTOCOL  *This,
+  IN  UINTN                    BufferIndex,
+  OUT EFI_PHYSICAL_ADDRESS     *Address
+  );
+
+/**
+  Queue a flip to a buffer. The DSS scans out the buffer from the next VSYNC on.
+
+  @param  This                  Pointer to the protocol instance.
+  @param  BufferIndex           Buffer to display.
+  @param  Event                 Signaled once the buffer is displayed, and the buffer
+                                displayed before can be drawn into again. Optional.
+
+  @retval EFI_SUCCESS           The flip was queued.
+  @retval EFI_INVALID_PARAMETER BufferIndex is not below BufferCount.
+  @retval EFI_NOT_READY         The previous flip has not completed yet.
+
+**/
+typedef
+EFI_STATUS
+(EFIAPI *OMAP_PAGE_FLIP_FLIP) (
+  IN OMAP_PAGE_FLIP_PROTOCOL  *This,
+  IN UINTN                    BufferIndex,
+  IN EFI_EVENT                Event       OPTIONAL
+  );
+
+struct _OMAP_PAGE_FLIP_PROTOCOL {
+  UINTN                       BufferCount;      // Buffers of the current mode, including buffer 0
+  UINTN                       DisplayedBuffer;  // Buffer scanned out by the DSS
+  OMAP_PAGE_FLIP_GET_BUFFER   GetBuffer;
+  OMAP_PAGE_FLIP_FLIP         Flip;
+};
+
+extern EFI_GUID gOmapPageFlipProtocolGuid;
+
+#endif
@@ -1,445 +1,1014 @@
-/** @file
-
- Copyright (c) 2011, ARM Ltd. All rights reserved.<BR>
- This program and the accompanying materials
- are licensed and made available under the terms and conditions of the BSD License
- which accompanies this distribution.  The full text of the license may be found at
- http://opensource.org/licenses/bsd-license.php
-
- THE PROGRAM IS DISTRIBUTED UNDER THE BSD LICENSE ON AN "AS IS" BASIS,
- WITHOUT WARRANTIES OR REPRESENTATIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED.
-
- **/
-
-#include <PiDxe.h>
-#include <Library/BaseMemoryLib.h>
-#include <Library/DevicePathLib.h>
-#include <Library/UefiBootServicesTableLib.h>
-#include <Library/UefiRuntimeServicesTableLib.h>
-#include <Library/MemoryAllocationLib.h>
-
-#include <Guid/GlobalVariable.h>
-
-#include "LcdGraphicsOutputDxe.h"
-
-extern BOOLEAN mDisplayInitialized;
-
-//
-// Function Definitions
-//
-
-STATIC
-EFI_STATUS
-VideoCopyNoHorizontalOverlap (
-  IN UINTN          BitsPerPixel,
-  IN volatile VOID  *FrameBufferBase,
-  IN UINT32         HorizontalResolution,
-  IN UINTN          SourceX,
-  IN UINTN          SourceY,
-  IN UINTN          DestinationX,
-  IN UINTN          DestinationY,
-  IN UINTN          Width,
-  IN UINTN          Height
-  )
-{
-  EFI_STATUS    Status = EFI_SUCCESS;
-  UINTN         SourceLine;
-  UINTN         DestinationLine;
-  UINTN         WidthInBytes;
-  UINTN         LineCount;
-  INTN          Step;
-  VOID          *SourceAddr;
-  VOID          *DestinationAddr;
-
-  if( DestinationY <= SourceY ) {
-    // scrolling up (or horizontally but without overlap)
-    SourceLine       = SourceY;
-    DestinationLine  = DestinationY;
-    Step             = 1;
-  } else {
-    // scrolling down
-    SourceLine       = SourceY + Height;
-    DestinationLine  = DestinationY + Height;
-    Step             = -1;
-  }
-
-  WidthInBytes = Width * 2;
-
-  for( LineCount = 0; LineCount < Height; LineCount++ ) {
-    // Update the start addresses of source & destination using 16bit pointer arithmetic
-    SourceAddr      = (VOID *)((UINT16 *)FrameBufferBase + SourceLine      * HorizontalResolution + SourceX     );
-    DestinationAddr = (VOID *)((UINT16 *)FrameBufferBase + DestinationLine * HorizontalResolution + DestinationX);
-
-    // Copy the entire line Y from video ram to the temp buffer
-    CopyMem( DestinationAddr, SourceAddr, WidthInBytes);
-
-    // Update the line numbers
-    SourceLine      += Step;
-    DestinationLine += Step;
-  }
-
-  return Status;
-}
-
-STATIC
-EFI_STATUS
-VideoCopyHorizontalOverlap (
-  IN UINTN          BitsPerPixel,
-  IN volatile VOID  *FrameBufferBase,
-  UINT32            HorizontalResolution,
-  IN UINTN          SourceX,
-  IN UINTN          SourceY,
-  IN UINTN          DestinationX,
-  IN UINTN          DestinationY,
-  IN UINTN          Width,
-  IN UINTN          Height
-  )
-{
-  EFI_STATUS      Status = EFI_SUCCESS;
-
-  UINT16 *PixelBuffer16bit;
-  UINT16 *SourcePixel16bit;
-  UINT16 *DestinationPixel16bit;
-
-  UINT32          SourcePixelY;
-  UINT32          DestinationPixelY;
-  UINTN           SizeIn16Bits;
-
-  // Allocate a temporary buffer
-  PixelBuffer16bit = (UINT16 *) AllocatePool((Height * Width) * sizeof(UINT16));
-
-  if (PixelBuffer16bit == NULL) {
-    Status = EFI_OUT_OF_RESOURCES;
-    goto EXIT;
-  }
-
-  // Access each pixel inside the source area of the Video Memory and copy it to the temp buffer
-
-  SizeIn16Bits = Width * 2;
-
-  for (SourcePixelY = SourceY, DestinationPixel16bit = PixelBuffer16bit;
-       SourcePixelY < SourceY + Height;
-       SourcePixelY++, DestinationPixel16bit += Width)
-  {
-    // Calculate the source address:
-    SourcePixel16bit = (UINT16 *)FrameBufferBase + SourcePixelY * HorizontalResolution + SourceX;
-
-    // Copy the entire line Y from Video to the temp buffer
-    CopyMem( (VOID *)DestinationPixel16bit, (CONST VOID *)SourcePixel16bit, SizeIn16Bits);
-  }
-
-  // Copy from the temp buffer into the destination area of the Video Memory
-
-  for (DestinationPixelY = DestinationY, SourcePixel16bit = PixelBuffer16bit;
-       DestinationPixelY < DestinationY + Height;
-       DestinationPixelY++, SourcePixel16bit += Width)
-  {
-    // Calculate the target address:
-    DestinationPixel16bit = (UINT16 *)FrameBufferBase + (DestinationPixelY * HorizontalResolution + DestinationX);
-
-    // Copy the entire line Y from the temp buffer to Video
-    CopyMem( (VOID *)DestinationPixel16bit, (CONST VOID *)SourcePixel16bit, SizeIn16Bits);
-  }
-
-  // Free the allocated memory
-  FreePool((VOID *) PixelBuffer16bit);
-
-
-EXIT:
-  return Status;
-}
-
-STATIC
-EFI_STATUS
-BltVideoFill (
-  IN EFI_GRAPHICS_OUTPUT_PROTOCOL        *This,
-  IN OUT EFI_GRAPHICS_OUTPUT_BLT_PIXEL   *EfiSourcePixel,     OPTIONAL
-  IN UINTN                               SourceX,
-  IN UINTN                               SourceY,
-  IN UINTN                               DestinationX,
-  IN UINTN                               DestinationY,
-  IN UINTN                               Width,
-  IN UINTN                               Height,
-  IN UINTN                               Delta           OPTIONAL   // Number of BYTES in a row of the BltBuffer
-  )
-{
-  EFI_PIXEL_BITMASK*  PixelInformation;
-  EFI_STATUS          Status;
-  UINT32              HorizontalResolution;
-  VOID                *FrameBufferBase;
-  UINT16              *DestinationPixel16bit;
-  UINT16              Pixel16bit;
-  UINT32              DestinationPixelX;
-  UINT32              DestinationLine;
-
-  Status           = EFI_SUCCESS;
-  PixelInformation = &This->Mode->Info->PixelInformation;
-  FrameBufferBase = (UINTN *)((UINTN)(This->Mode->FrameBufferBase));
-  HorizontalResolution = This->Mode->Info->HorizontalResolution;
-
-  // Convert the EFI pixel at the start of the BltBuffer(0,0) into a video display pixel
-  Pixel16bit = (UINT16) (
-      ( (EfiSourcePixel->Red      <<  8) & PixelInformation->RedMask      )
-    | ( (EfiSourcePixel->Green    <<  3) & PixelInformation->GreenMask    )
-    | ( (EfiSourcePixel->Blue     >>  3) & PixelInformation->BlueMask     )
-   );
-
-  // Copy the SourcePixel into every pixel inside the target rectangle
-  for (DestinationLine = DestinationY;
-       DestinationLine < DestinationY + Height;
-       DestinationLine++)
-  {
-    for (DestinationPixelX = DestinationX;
-         DestinationPixelX < DestinationX + Width;
-         DestinationPixelX++)
-    {
-      // Calculate the target address:
-      DestinationPixel16bit =  (UINT16 *)FrameBufferBase + DestinationLine * HorizontalResolution  + DestinationPixelX;
-
-      // Copy the pixel into the new target
-      *DestinationPixel16bit = Pixel16bit;
-    }
-  }
-
-
-  return Status;
-}
-
-STATIC
-EFI_STATUS
-BltVideoToBltBuffer (
-  IN EFI_GRAPHICS_OUTPUT_PROTOCOL        *This,
-  IN OUT EFI_GRAPHICS_OUTPUT_BLT_PIXEL   *BltBuffer,     OPTIONAL
-  IN UINTN                               SourceX,
-  IN UINTN                               SourceY,
-  IN UINTN                               DestinationX,
-  IN UINTN                               DestinationY,
-  IN UINTN                               Width,
-  IN UINTN                               Height,
-  IN UINTN                               Delta           OPTIONAL   // Number of BYTES in a row of the BltBuffer
-  )
-{
-  EFI_STATUS         Status;
-  UINT32             HorizontalResolution;
-  EFI_PIXEL_BITMASK  *PixelInformation;
-  EFI_GRAPHICS_OUTPUT_BLT_PIXEL *EfiDestinationPixel;
-  VOID               *FrameBufferBase;
-  UINT16             *SourcePixel16bit;
-  UINT16             Pixel16bit;
-  UINT32             SourcePixelX;
-  UINT32             SourceLine;
-  UINT32             DestinationPixelX;
-  UINT32             DestinationLine;
-  UINT32             BltBufferHorizontalResolution;
-
-  Status = EFI_SUCCESS;
-  PixelInformation = &This->Mode->Info->PixelInformation;
-  HorizontalResolution = This->Mode->Info->HorizontalResolution;
-  FrameBufferBase = (UINTN *)((UINTN)(This->Mode->FrameBufferBase));
-
-  if(( Delta != 0 ) && ( Delta != Width * sizeof(EFI_GRAPHICS_OUTPUT_BLT_PIXEL))) {
-    // Delta is not zero and it is different from the width.
-    // Divide it by the size of a pixel to find out the buffer's horizontal resolution.
-    BltBufferHorizontalResolution = (UINT32) (Delta / sizeof(EFI_GRAPHICS_OUTPUT_BLT_PIXEL));
-  } else {
-    BltBufferHorizontalResolution = Width;
-  }
-
-  // Access each pixel inside the Video Memory
-  for (SourceLine = SourceY, DestinationLine = DestinationY;
-       SourceLine < SourceY + Height;
-       SourceLine++, DestinationLine++)
-  {
-    for (SourcePixelX = SourceX, DestinationPixelX = DestinationX;
-         SourcePixelX < SourceX + Width;
-         SourcePixelX++, DestinationPixelX++)
-    {
-      // Calculate the source and target addresses:
-      SourcePixel16bit = (UINT16 *)FrameBufferBase + SourceLine * HorizontalResolution + SourcePixelX;
-      EfiDestinationPixel = BltBuffer + DestinationLine * BltBufferHorizontalResolution + DestinationPixelX;
-
-      // Snapshot the pixel from the video buffer once, to speed up the operation.
-      // If we were dereferencing the pointer, as it is volatile, we would perform 3 memory read operations.
-      Pixel16bit = *SourcePixel16bit;
-
-      // Copy the pixel into the new target
-      EfiDestinationPixel->Red      = (UINT8) ( (Pixel16bit & PixelInformation->RedMask     ) >>  8 );
-      EfiDestinationPixel->Green    = (UINT8) ( (Pixel16bit & PixelInformation->GreenMask   ) >>  3 );
-      EfiDestinationPixel->Blue     = (UINT8) ( (Pixel16bit & PixelInformation->BlueMask    ) <<  3 );
-    }
-  }
-
-  return Status;
-}
-
-STATIC
-EFI_STATUS
-BltBufferToVideo (
-  IN EFI_GRAPHICS_OUTPUT_PROTOCOL        *This,
-  IN OUT EFI_GRAPHICS_OUTPUT_BLT_PIXEL   *BltBuffer,     OPTIONAL
-  IN UINTN                               SourceX,
-  IN UINTN                               SourceY,
-  IN UINTN                               DestinationX,
-  IN UINTN                               DestinationY,
-  IN UINTN                               Width,
-  IN UINTN                               Height,
-  IN UINTN                               Delta           OPTIONAL   // Number of BYTES in a row of the BltBuffer
-  )
-{
-  EFI_STATUS         Status;
-  UINT32             HorizontalResolution;
-  EFI_PIXEL_BITMASK  *PixelInformation;
-  EFI_GRAPHICS_OUTPUT_BLT_PIXEL *EfiSourcePixel;
-  VOID               *FrameBufferBase;
-  UINT16             *DestinationPixel16bit;
-  UINT32             SourcePixelX;
-  UINT32             SourceLine;
-  UINT32             DestinationPixelX;
-  UINT32             DestinationLine;
-  UINT32             BltBufferHorizontalResolution;
-
-  Status = EFI_SUCCESS;
-  PixelInformation = &This->Mode->Info->PixelInformation;
-  HorizontalResolution = This->Mode->Info->HorizontalResolution;
-  FrameBufferBase = (UINTN *)((UINTN)(This->Mode->FrameBufferBase));
-
-  if(( Delta != 0 ) && ( Delta != Width * sizeof(EFI_GRAPHICS_OUTPUT_BLT_PIXEL))) {
-    // Delta is not zero and it is different from the width.
-    // Divide it by the size of a pixel to find out the buffer's horizontal resolution.
-    BltBufferHorizontalResolution = (UINT32) (Delta / sizeof(EFI_GRAPHICS_OUTPUT_BLT_PIXEL));
-  } else {
-    BltBufferHorizontalResolution = Width;
-  }
-
-  // Access each pixel inside the BltBuffer Memory
-  for (SourceLine = SourceY, DestinationLine = DestinationY;
-       SourceLine < SourceY + Height;
-       SourceLine++, DestinationLine++) {
-
-    for (SourcePixelX = SourceX, DestinationPixelX = DestinationX;
-         SourcePixelX < SourceX + Width;
-         SourcePixelX++, DestinationPixelX++)
-    {
-      // Calculate the source and target addresses:
-      EfiSourcePixel  = BltBuffer + SourceLine * BltBufferHorizontalResolution + SourcePixelX;
-      DestinationPixel16bit = (UINT16 *)FrameBufferBase + DestinationLine * HorizontalResolution + DestinationPixelX;
-
-      // Copy the pixel into the new target
-      // Only the most significant bits will be copied across:
-      // To convert from 8 bits to 5 bits per pixel we throw away the 3 least significant bits
-        *DestinationPixel16bit = (UINT16) (
-              ( (EfiSourcePixel->Red      <<  8) & PixelInformation->RedMask      )
-            | ( (EfiSourcePixel->Green    <<  3) & PixelInformation->GreenMask    )
-            | ( (EfiSourcePixel->Blue     >>  3) & PixelInformation->BlueMask     )
-            );
-      }
-    }
-
-  return Status;
-}
-
-STATIC
-EFI_STATUS
-BltVideoToVideo (
-  IN EFI_GRAPHICS_OUTPUT_PROTOCOL        *This,
-  IN OUT EFI_GRAPHICS_OUTPUT_BLT_PIXEL   *BltBuffer,     OPTIONAL
-  IN UINTN                               SourceX,
-  IN UINTN                               SourceY,
-  IN UINTN                               DestinationX,
-  IN UINTN                               DestinationY,
-  IN UINTN                               Width,
-  IN UINTN                               Height,
-  IN UINTN                               Delta           OPTIONAL   // Number of BYTES in a row of the BltBuffer
-  )
-{
-  EFI_STATUS         Status;
-  UINT32             HorizontalResolution;
-  UINTN              BitsPerPixel;
-  VOID               *FrameBufferBase;
-
-  BitsPerPixel = 16;
-
-  HorizontalResolution = This->Mode->Info->HorizontalResolution;
-  FrameBufferBase = (UINTN *)((UINTN)(This->Mode->FrameBufferBase));
-
-  //
-  // BltVideo to BltVideo:
-  //
-  //  Source is the Video Memory,
-  //  Destination is the Video Memory
-
-  FrameBufferBase = (UINTN *)((UINTN)(This->Mode->FrameBufferBase));
-
-  // The UEFI spec currently states:
-  // "There is no limitation on the overlapping of the source and destination rectangles"
-  // Therefore, we must be careful to avoid overwriting the source data
-  if( SourceY == DestinationY ) {
-    // Copying within the same height, e.g. horizontal shift
-    if( SourceX == DestinationX ) {
-      // Nothing to do
-      Status = EFI_SUCCESS;
-    } else if( ((SourceX>DestinationX)?(SourceX - DestinationX):(DestinationX - SourceX)) < Width ) {
-      // There is overlap
-      Status = VideoCopyHorizontalOverlap (BitsPerPixel, FrameBufferBase, HorizontalResolution, SourceX, SourceY, DestinationX, DestinationY, Width, Height );
-    } else {
-      // No overlap
-      Status = VideoCopyNoHorizontalOverlap (BitsPerPixel, FrameBufferBase, HorizontalResolution, SourceX, SourceY, DestinationX, DestinationY, Width, Height );
-    }
-  } else {
-    // Copying from different heights
-    Status = VideoCopyNoHorizontalOverlap (BitsPerPixel, FrameBufferBase, HorizontalResolution, SourceX, SourceY, DestinationX, DestinationY, Width, Height );
-  }
-
-  return Status;
-}
-
-EFI_STATUS
-EFIAPI
-LcdGraphicsBlt (
-  IN EFI_GRAPHICS_OUTPUT_PROTOCOL        *This,
-  IN OUT EFI_GRAPHICS_OUTPUT_BLT_PIXEL   *BltBuffer,     OPTIONAL
-  IN EFI_GRAPHICS_OUTPUT_BLT_OPERATION   BltOperation,
-  IN UINTN                               SourceX,
-  IN UINTN                               SourceY,
-  IN UINTN                               DestinationX,
-  IN UINTN                               DestinationY,
-  IN UINTN                               Width,
-  IN UINTN                               Height,
-  IN UINTN                               Delta           OPTIONAL   // Number of BYTES in a row of the BltBuffer
-  )
-{
-  EFI_STATUS    Status;
-  LCD_INSTANCE  *Instance;
-
-  Instance = LCD_INSTANCE_FROM_GOP_THIS(This);
-
-  if (!mDisplayInitialized) {
-    InitializeDisplay (Instance);
-  }
-
-  switch (BltOperation) {
-  case EfiBltVideoFill:
-    Status = BltVideoFill (This, BltBuffer, SourceX, SourceY, DestinationX, DestinationY, Width, Height, Delta);
-    break;
-
-  case EfiBltVideoToBltBuffer:
-    Status = BltVideoToBltBuffer (This, BltBuffer, SourceX, SourceY, DestinationX, DestinationY, Width, Height, Delta);
-    break;
-
-  case EfiBltBufferToVideo:
-    Status = BltBufferToVideo (This, BltBuffer, SourceX, SourceY, DestinationX, DestinationY, Width, Height, Delta);
-    break;
-
-  case EfiBltVideoToVideo:
-    Status = BltVideoToVideo (This, BltBuffer, SourceX, SourceY, DestinationX, DestinationY, Width, Height, Delta);
-    break;
-
-  case EfiGraphicsOutputBltOperationMax:
-  default:
-    DEBUG((DEBUG_ERROR, "LcdGraphicsBlt: Invalid Operation\n"));
-    Status = EFI_INVALID_PARAMETER;
-    break;
-}
-
-  return Status;
-}
+/** @file
+
+ Copyright (c) 2011, ARM Ltd. All rights reserved.<BR>
+ This program and the accompanying materials
+ are licensed and made available under the terms and conditions of the BSD License
+ which accompanies this distribution.  The full text of the license may be found at
+ http://opensource.org/licenses/bsd-license.php
+
+ THE PROGRAM IS DISTRIBUTED UNDER THE BSD LICENSE ON AN "AS IS" BASIS,
+ WITHOUT WARRANTIES OR REPRESENTATIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED.
+
+ **/
+
+#include <PiDxe.h>
+#include <Library/BaseLib.h>
+#include <Library/BaseMemoryLib.h>
+#include <Library/DevicePathLib.h>
+#include <Library/UefiBootServicesTableLib.h>
+#include <Library/UefiRuntimeServicesTableLib.h>
+#include <Library/MemoryAllocationLib.h>
+
+#include <Guid/GlobalVariable.h>
+
+#include "LcdGraphicsOutputDxe.h"
+
+extern BOOLEAN mDisplayInitialized;
+
+//
+// Function Definitions
+//
+
+STATIC
+BOOLEAN
+LcdBltOnShadow (
+  IN EFI_GRAPHICS_OUTPUT_PROTOCOL  *This
+  )
+{
+  LCD_INSTANCE  *Instance;
+
+  Instance = LCD_INSTANCE_FROM_GOP_THIS(This);
+
+  return ((Instance->ShadowFrameBuffer != NULL) && (Instance->ModeInfo.PixelFormat == PixelBltOnly));
+}
+
+// Blt operations work on the cached shadow when there is one, the flush copies it to the VRAM
+STATIC
+VOID *
+LcdGetBltFrameBuffer (
+  IN EFI_GRAPHICS_OUTPUT_PROTOCOL  *This
+  )
+{
+  LCD_INSTANCE  *Instance;
+
+  Instance = LCD_INSTANCE_FROM_GOP_THIS(This);
+
+  if (LcdBltOnShadow (This)) {
+    return (UINT8 *)Instance->ShadowFrameBuffer + Instance->ShadowFrameOffset;
+  }
+
+  return (UINT8 *)(UINTN)This->Mode->FrameBufferBase + Instance->FrameOffset;
+}
+
+// Add an area to the dirty list. Areas that overlap or touch are merged, and once the
+// list is full the area is merged into the last entry, so the list never loses pixels.
+STATIC
+VOID
+LcdMarkDirty (
+  IN LCD_INSTANCE  *Instance,
+  IN UINTN         X,
+  IN UINTN         Y,
+  IN UINTN         Width,
+  IN UINTN         Height
+  )
+{
+  LCD_DIRTY_RECT  Rect;
+  LCD_DIRTY_RECT  *Dirty;
+  UINTN           Index;
+
+  if ((Instance->ShadowFrameBuffer == NULL) || (Instance->ModeInfo.PixelFormat != PixelBltOnly) ||
+      (Width == 0) || (Height == 0)) {
+    return;
+  }
+
+  Rect.Left   = X;
+  Rect.Top    = Y;
+  Rect.Right  = X + Width;
+  Rect.Bottom = Y + Height;
+
+  for (Index = 0; Index < Instance->DirtyRectCount; Index++) {
+    Dirty = &Instance->DirtyRect[Index];
+    if ((Rect.Left <= Dirty->Right) && (Dirty->Left <= Rect.Right) &&
+        (Rect.Top <= Dirty->Bottom) && (Dirty->Top <= Rect.Bottom)) {
+      break;
+    }
+  }
+
+  if (Index == Instance->DirtyRectCount) {
+    if (Instance->DirtyRectCount < LCD_MAX_DIRTY_RECTS) {
+      Instance->DirtyRect[Instance->DirtyRectCount++] = Rect;
+      return;
+    }
+    Index = LCD_MAX_DIRTY_RECTS - 1;
+  }
+
+  Dirty = &Instance->DirtyRect[Index];
+  Dirty->Left   = MIN (Dirty->Left,   Rect.Left);
+  Dirty->Top    = MIN (Dirty->Top,    Rect.Top);
+  Dirty->Right  = MAX (Dirty->Right,  Rect.Right);
+  Dirty->Bottom = MAX (Dirty->Bottom, Rect.Bottom);
+}
+
+// Copy the dirty areas of the shadow to the VRAM. Must be called at TPL_NOTIFY or
+// with the flush timer not running.
+VOID
+LcdFlushShadowFrameBuffer (
+  IN LCD_INSTANCE  *Instance
+  )
+{
+  LCD_DIRTY_RECT  *Dirty;
+  UINTN           Index;
+  UINTN           Line;
+  UINTN           Offset;
+  UINTN           HorizontalResolution;
+
+  if ((Instance->ShadowFrameBuffer == NULL) || (Instance->DirtyRectCount == 0)) {
+    return;
+  }
+
+  HorizontalResolution = Instance->ModeInfo.HorizontalResolution;
+
+  for (Index = 0; Index < Instance->DirtyRectCount; Index++) {
+    Dirty = &Instance->DirtyRect[Index];
+    for (Line = Dirty->Top; Line < Dirty->Bottom; Line++) {
+      Offset = (Line * HorizontalResolution + Dirty->Left) * 2;
+      CopyMem (
+        (UINT8 *)(UINTN)Instance->Mode.FrameBufferBase + Instance->FrameOffset + Offset,
+        (UINT8 *)Instance->ShadowFrameBuffer + Instance->ShadowFrameOffset + Offset,
+        (Dirty->Right - Dirty->Left) * 2
+        );
+    }
+  }
+
+  Instance->DirtyRectCount = 0;
+
+  // Drain the write buffer so the DSS DMA sees the new pixels
+  ArmDataSynchronizationBarrier ();
+}
+
+VOID
+EFIAPI
+LcdFlushTimerHandler (
+  IN EFI_EVENT  Event,
+  IN VOID       *Context
+  )
+{
+  LcdFlushShadowFrameBuffer ((LCD_INSTANCE *)Context);
+}
+
+STATIC
+EFI_STATUS
+VideoCopyNoHorizontalOverlap (
+  IN UINTN          BitsPerPixel,
+  IN volatile VOID  *FrameBufferBase,
+  IN UINT32         HorizontalResolution,
+  IN UINTN          SourceX,
+  IN UINTN          SourceY,
+  IN UINTN          DestinationX,
+  IN UINTN          DestinationY,
+  IN UINTN          Width,
+  IN UINTN          Height
+  )
+{
+  EFI_STATUS    Status = EFI_SUCCESS;
+  UINTN         SourceLine;
+  UINTN         DestinationLine;
+  UINTN         BytesPerPixel;
+  UINTN         WidthInBytes;
+  UINTN         LineCount;
+  INTN          Step;
+  VOID          *SourceAddr;
+  VOID          *DestinationAddr;
+
+  if( DestinationY <= SourceY ) {
+    // scrolling up (or horizontally but without overlap)
+    SourceLine       = SourceY;
+    DestinationLine  = DestinationY;
+    Step             = 1;
+  } else {
+    // scrolling down, start from the last line
+    SourceLine       = SourceY + Height - 1;
+    DestinationLine  = DestinationY + Height - 1;
+    Step             = -1;
+  }
+
+  BytesPerPixel = BitsPerPixel / 8;
+  WidthInBytes = Width * BytesPerPixel;
+
+  for( LineCount = 0; LineCount < Height; LineCount++ ) {
+    // Update the start addresses of source & destination
+    SourceAddr      = (VOID *)((UINT8 *)FrameBufferBase + (SourceLine      * HorizontalResolution + SourceX     ) * BytesPerPixel);
+    DestinationAddr = (VOID *)((UINT8 *)FrameBufferBase + (DestinationLine * HorizontalResolution + DestinationX) * BytesPerPixel);
+
+    // Copy the entire line Y from video ram to the temp buffer
+    CopyMem( DestinationAddr, SourceAddr, WidthInBytes);
+
+    // Update the line numbers
+    SourceLine      += Step;
+    DestinationLine += Step;
+  }
+
+  return Status;
+}
+
+STATIC
+EFI_STATUS
+VideoCopyHorizontalOverlap (
+  IN UINTN          BitsPerPixel,
+  IN volatile VOID  *FrameBufferBase,
+  UINT32            HorizontalResolution,
+  IN UINTN          SourceX,
+  IN UINTN          SourceY,
+  IN UINTN          DestinationX,
+  IN UINTN          DestinationY,
+  IN UINTN          Width,
+  IN UINTN          Height
+  )
+{
+  UINT8           *SourcePixel;
+  UINT8           *DestinationPixel;
+  UINTN           LineCount;
+  UINTN           BytesPerPixel;
+  UINTN           WidthInBytes;
+  UINTN           LineInBytes;
+
+  // Source and destination are on the same lines, so each line only overlaps with itself.
+  // CopyMem handles overlapping buffers, no need to stage the rectangle in a temp buffer.
+  BytesPerPixel = BitsPerPixel / 8;
+  WidthInBytes = Width * BytesPerPixel;
+  LineInBytes = HorizontalResolution * BytesPerPixel;
+
+  SourcePixel      = (UINT8 *)FrameBufferBase + (SourceY * HorizontalResolution + SourceX) * BytesPerPixel;
+  DestinationPixel = (UINT8 *)FrameBufferBase + (DestinationY * HorizontalResolution + DestinationX) * BytesPerPixel;
+
+  for (LineCount = 0; LineCount < Height; LineCount++) {
+    CopyMem ((VOID *)DestinationPixel, (CONST VOID *)SourcePixel, WidthInBytes);
+
+    SourcePixel      += LineInBytes;
+    DestinationPixel += LineInBytes;
+  }
+
+  return EFI_SUCCESS;
+}
+
+// Fill Count pixels of a row with Pixel16bit. The pixel is replicated into a 64bit word
+// so the body of the row is written with doubleword stores once the destination is aligned.
+STATIC
+VOID
+LcdFillRow16 (
+  IN UINT16  *Destination,
+  IN UINTN   Count,
+  IN UINT16  Pixel16bit
+  )
+{
+  UINT32  Pixel32bit;
+  UINT64  Pixel64bit;
+  UINT64  *Destination64bit;
+
+  Pixel32bit = ((UINT32)Pixel16bit << 16) | Pixel16bit;
+  Pixel64bit = LShiftU64 (Pixel32bit, 32) | Pixel32bit;
+
+  // Head: halfwords up to the next 64bit boundary
+  while ((Count > 0) && (((UINTN)Destination & (sizeof (UINT64) - 1)) != 0)) {
+    *Destination++ = Pixel16bit;
+    Count--;
+  }
+
+  // Body: four pixels per store
+  Destination64bit = (UINT64 *)Destination;
+  while (Count >= 4) {
+    *Destination64bit++ = Pixel64bit;
+    Count -= 4;
+  }
+
+  // Tail
+  Destination = (UINT16 *)Destination64bit;
+  while (Count > 0) {
+    *Destination++ = Pixel16bit;
+    Count--;
+  }
+}
+
+STATIC
+EFI_STATUS
+BltVideoFill (
+  IN EFI_GRAPHICS_OUTPUT_PROTOCOL        *This,
+  IN OUT EFI_GRAPHICS_OUTPUT_BLT_PIXEL   *EfiSourcePixel,     OPTIONAL
+  IN UINTN                               SourceX,
+  IN UINTN                               SourceY,
+  IN UINTN                               DestinationX,
+  IN UINTN                               DestinationY,
+  IN UINTN                               Width,
+  IN UINTN                               Height,
+  IN UINTN                               Delta           OPTIONAL   // Number of BYTES in a row of the BltBuffer
+  )
+{
+  EFI_PIXEL_BITMASK*  PixelInformation;
+  EFI_STATUS          Status;
+  UINT32              HorizontalResolution;
+  VOID                *FrameBufferBase;
+  UINT16              *FirstLine16bit;
+  UINT16              *DestinationPixel16bit;
+  UINT16              Pixel16bit;
+  UINT32              DestinationLine;
+
+  Status           = EFI_SUCCESS;
+  PixelInformation = &This->Mode->Info->PixelInformation;
+  FrameBufferBase = LcdGetBltFrameBuffer (This);
+  HorizontalResolution = This->Mode->Info->HorizontalResolution;
+
+  if ((Width == 0) || (Height == 0)) {
+    return Status;
+  }
+
+  // Convert the EFI pixel at the start of the BltBuffer(0,0) into a video display pixel
+  Pixel16bit = (UINT16) (
+      ( (EfiSourcePixel->Red      <<  8) & PixelInformation->RedMask      )
+    | ( (EfiSourcePixel->Green    <<  3) & PixelInformation->GreenMask    )
+    | ( (EfiSourcePixel->Blue     >>  3) & PixelInformation->BlueMask     )
+   );
+
+  // Large rectangles are filled by the system DMA
+  if (!EFI_ERROR (LcdDmaFill (FrameBufferBase, LcdBltOnShadow (This),
+                              HorizontalResolution, 2, Pixel16bit, DestinationX, DestinationY, Width, Height))) {
+    return Status;
+  }
+
+  // Fill the first line of the target rectangle
+  FirstLine16bit = (UINT16 *)FrameBufferBase + DestinationY * HorizontalResolution + DestinationX;
+  LcdFillRow16 (FirstLine16bit, Width, Pixel16bit);
+
+  // Replicate it into the other lines with block copies. Reading the uncached VRAM back
+  // costs more than filling again, so without the shadow every line is filled.
+  DestinationPixel16bit = FirstLine16bit;
+  for (DestinationLine = 1; DestinationLine < Height; DestinationLine++) {
+    DestinationPixel16bit += HorizontalResolution;
+    if (!LcdBltOnShadow (This)) {
+      LcdFillRow16 (DestinationPixel16bit, Width, Pixel16bit);
+    } else {
+      CopyMem (DestinationPixel16bit, FirstLine16bit, Width * 2);
+    }
+  }
+
+  return Status;
+}
+
+// Pixels read from the VRAM in one burst by BltVideoToBltBuffer
+#define LCD_BLT_READ_CHUNK_PIXELS   64
+
+// Blt pixels for the high and the low byte of an RGB565 pixel. The low bits of every
+// color are copies of its high bits, so full scale RGB565 expands to 0xFF.
+STATIC UINT32 mLcdRgb565HighByte[256];
+STATIC UINT32 mLcdRgb565LowByte[256];
+
+VOID
+LcdInitializeBltTables (
+  VOID
+  )
+{
+  UINTN   Index;
+  UINT32  Red;
+  UINT32  Green;
+  UINT32  Blue;
+
+  for (Index = 0; Index < 256; Index++) {
+    // High byte: RRRRRGGG
+    Red   = Index >> 3;
+    Red   = (Red << 3) | (Red >> 2);
+    Green = ((Index & 0x7) << 5) | ((Index & 0x7) >> 1);
+    mLcdRgb565HighByte[Index] = (Red << 16) | (Green << 8);
+
+    // Low byte: GGGBBBBB. The replicated green bits come from the high byte.
+    Green = (Index >> 5) << 2;
+    Blue  = Index & 0x1F;
+    Blue  = (Blue << 3) | (Blue >> 2);
+    mLcdRgb565LowByte[Index] = (Green << 8) | Blue;
+  }
+}
+
+STATIC
+VOID
+LcdExpandRowFromRgb565 (
+  OUT EFI_GRAPHICS_OUTPUT_BLT_PIXEL  *Destination,
+  IN  UINT16                         *Source,
+  IN  UINTN                          Count
+  )
+{
+  EFI_GRAPHICS_OUTPUT_BLT_PIXEL_UNION  *Destination32bit;
+  UINT16                               Pixel16bit;
+
+  Destination32bit = (EFI_GRAPHICS_OUTPUT_BLT_PIXEL_UNION *)Destination;
+
+  for (; Count > 0; Count--) {
+    Pixel16bit = *Source++;
+    (Destination32bit++)->Raw = mLcdRgb565HighByte[Pixel16bit >> 8] | mLcdRgb565LowByte[Pixel16bit & 0xFF];
+  }
+}
+
+STATIC
+EFI_STATUS
+BltVideoToBltBuffer (
+  IN EFI_GRAPHICS_OUTPUT_PROTOCOL        *This,
+  IN OUT EFI_GRAPHICS_OUTPUT_BLT_PIXEL   *BltBuffer,     OPTIONAL
+  IN UINTN                               SourceX,
+  IN UINTN                               SourceY,
+  IN UINTN                               DestinationX,
+  IN UINTN                               DestinationY,
+  IN UINTN                               Width,
+  IN UINTN                               Height,
+  IN UINTN                               Delta           OPTIONAL   // Number of BYTES in a row of the BltBuffer
+  )
+{
+  EFI_STATUS         Status;
+  UINT32             HorizontalResolution;
+  EFI_GRAPHICS_OUTPUT_BLT_PIXEL *EfiDestinationPixel;
+  VOID               *FrameBufferBase;
+  UINT16             *SourcePixel16bit;
+  UINT16             LineBuffer[LCD_BLT_READ_CHUNK_PIXELS];
+  UINTN              Offset;
+  UINTN              Count;
+  UINT32             SourceLine;
+  UINT32             DestinationLine;
+  UINT32             BltBufferHorizontalResolution;
+  BOOLEAN            Uncached;
+
+  Status = EFI_SUCCESS;
+  HorizontalResolution = This->Mode->Info->HorizontalResolution;
+  FrameBufferBase = LcdGetBltFrameBuffer (This);
+  Uncached = !LcdBltOnShadow (This);
+
+  if(( Delta != 0 ) && ( Delta != Width * sizeof(EFI_GRAPHICS_OUTPUT_BLT_PIXEL))) {
+    // Delta is not zero and it is different from the width.
+    // Divide it by the size of a pixel to find out the buffer's horizontal resolution.
+    BltBufferHorizontalResolution = (UINT32) (Delta / sizeof(EFI_GRAPHICS_OUTPUT_BLT_PIXEL));
+  } else {
+    BltBufferHorizontalResolution = Width;
+  }
+
+  // Expand the Video Memory one line at a time
+  for (SourceLine = SourceY, DestinationLine = DestinationY;
+       SourceLine < SourceY + Height;
+       SourceLine++, DestinationLine++)
+  {
+    SourcePixel16bit = (UINT16 *)FrameBufferBase + SourceLine * HorizontalResolution + SourceX;
+    EfiDestinationPixel = BltBuffer + DestinationLine * BltBufferHorizontalResolution + DestinationX;
+
+    if (!Uncached) {
+      LcdExpandRowFromRgb565 (EfiDestinationPixel, SourcePixel16bit, Width);
+      continue;
+    }
+
+    // Reading the uncached VRAM a pixel at a time stalls on every access, copy it
+    // to the stack in bursts first
+    for (Offset = 0; Offset < Width; Offset += Count) {
+      Count = MIN (Width - Offset, LCD_BLT_READ_CHUNK_PIXELS);
+      CopyMem (LineBuffer, SourcePixel16bit + Offset, Count * 2);
+      LcdExpandRowFromRgb565 (EfiDestinationPixel + Offset, LineBuffer, Count);
+    }
+  }
+
+  return Status;
+}
+
+// Only the most significant bits are kept: 8 bits per color become 5 (red, blue) or 6 (green)
+#define LCD_BLT_PIXEL_TO_RGB565(Red, Green, Blue)  \
+  ((UINT16)((((Red) & 0xF8) << 8) | (((Green) & 0xFC) << 3) | ((Blue) >> 3)))
+
+// Two RGB565 pixels in one word, the first pixel in the low halfword
+#define LCD_BLT_PIXELS_TO_RGB565X2(Pixel)  \
+  ((UINT32)LCD_BLT_PIXEL_TO_RGB565 ((Pixel)[0].Red, (Pixel)[0].Green, (Pixel)[0].Blue) | \
+   ((UINT32)LCD_BLT_PIXEL_TO_RGB565 ((Pixel)[1].Red, (Pixel)[1].Green, (Pixel)[1].Blue) << 16))
+
+// 4x4 ordered dither matrix, scaled to the 3 bits dropped from red and blue
+STATIC CONST UINT8 mLcdDitherMatrix[4][4] = {
+  { 0, 4, 1, 5 },
+  { 6, 2, 7, 3 },
+  { 1, 5, 0, 4 },
+  { 7, 3, 6, 2 }
+};
+
+// Convert a row of Blt pixels to RGB565. Once the destination is word aligned the body
+// converts 8 pixels per iteration and writes them with word stores.
+STATIC
+VOID
+LcdConvertRowToRgb565 (
+  OUT UINT16                         *Destination,
+  IN  EFI_GRAPHICS_OUTPUT_BLT_PIXEL  *Source,
+  IN  UINTN                          Count
+  )
+{
+  UINT32  *Destination32bit;
+
+  if ((Count > 0) && (((UINTN)Destination & (sizeof (UINT32) - 1)) != 0)) {
+    *Destination++ = LCD_BLT_PIXEL_TO_RGB565 (Source->Red, Source->Green, Source->Blue);
+    Source++;
+    Count--;
+  }
+
+  Destination32bit = (UINT32 *)Destination;
+  while (Count >= 8) {
+    Destination32bit[0] = LCD_BLT_PIXELS_TO_RGB565X2 (&Source[0]);
+    Destination32bit[1] = LCD_BLT_PIXELS_TO_RGB565X2 (&Source[2]);
+    Destination32bit[2] = LCD_BLT_PIXELS_TO_RGB565X2 (&Source[4]);
+    Destination32bit[3] = LCD_BLT_PIXELS_TO_RGB565X2 (&Source[6]);
+    Destination32bit += 4;
+    Source += 8;
+    Count -= 8;
+  }
+
+  while (Count >= 2) {
+    *Destination32bit++ = LCD_BLT_PIXELS_TO_RGB565X2 (Source);
+    Source += 2;
+    Count -= 2;
+  }
+
+  if (Count > 0) {
+    Destination = (UINT16 *)Destination32bit;
+    *Destination = LCD_BLT_PIXEL_TO_RGB565 (Source->Red, Source->Green, Source->Blue);
+  }
+}
+
+// Same as LcdConvertRowToRgb565, with an ordered dither to hide the banding of gradients.
+// X and Y are the screen position of the first pixel, they select the dither threshold.
+STATIC
+VOID
+LcdConvertRowToRgb565Dither (
+  OUT UINT16                         *Destination,
+  IN  EFI_GRAPHICS_OUTPUT_BLT_PIXEL  *Source,
+  IN  UINTN                          Count,
+  IN  UINTN                          X,
+  IN  UINTN                          Y
+  )
+{
+  CONST UINT8  *DitherRow;
+  UINTN        Threshold;
+  UINTN        Red;
+  UINTN        Green;
+  UINTN        Blue;
+
+  DitherRow = mLcdDitherMatrix[Y & 3];
+
+  for (; Count > 0; Count--, X++, Source++) {
+    Threshold = DitherRow[X & 3];
+    Red   = MIN (Source->Red   + Threshold,        0xFF);
+    Green = MIN (Source->Green + (Threshold >> 1), 0xFF);
+    Blue  = MIN (Source->Blue  + Threshold,        0xFF);
+
+    *Destination++ = LCD_BLT_PIXEL_TO_RGB565 (Red, Green, Blue);
+  }
+}
+
+STATIC
+EFI_STATUS
+BltBufferToVideo (
+  IN EFI_GRAPHICS_OUTPUT_PROTOCOL        *This,
+  IN OUT EFI_GRAPHICS_OUTPUT_BLT_PIXEL   *BltBuffer,     OPTIONAL
+  IN UINTN                               SourceX,
+  IN UINTN                               SourceY,
+  IN UINTN                               DestinationX,
+  IN UINTN                               DestinationY,
+  IN UINTN                               Width,
+  IN UINTN                               Height,
+  IN UINTN                               Delta           OPTIONAL   // Number of BYTES in a row of the BltBuffer
+  )
+{
+  EFI_STATUS         Status;
+  UINT32             HorizontalResolution;
+  EFI_GRAPHICS_OUTPUT_BLT_PIXEL *EfiSourcePixel;
+  VOID               *FrameBufferBase;
+  UINT16             *DestinationPixel16bit;
+  UINT32             SourceLine;
+  UINT32             DestinationLine;
+  UINT32             BltBufferHorizontalResolution;
+
+  Status = EFI_SUCCESS;
+  HorizontalResolution = This->Mode->Info->HorizontalResolution;
+  FrameBufferBase = LcdGetBltFrameBuffer (This);
+
+  if(( Delta != 0 ) && ( Delta != Width * sizeof(EFI_GRAPHICS_OUTPUT_BLT_PIXEL))) {
+    // Delta is not zero and it is different from the width.
+    // Divide it by the size of a pixel to find out the buffer's horizontal resolution.
+    BltBufferHorizontalResolution = (UINT32) (Delta / sizeof(EFI_GRAPHICS_OUTPUT_BLT_PIXEL));
+  } else {
+    BltBufferHorizontalResolution = Width;
+  }
+
+  // Convert the BltBuffer one line at a time
+  for (SourceLine = SourceY, DestinationLine = DestinationY;
+       SourceLine < SourceY + Height;
+       SourceLine++, DestinationLine++)
+  {
+    EfiSourcePixel  = BltBuffer + SourceLine * BltBufferHorizontalResolution + SourceX;
+    DestinationPixel16bit = (UINT16 *)FrameBufferBase + DestinationLine * HorizontalResolution + DestinationX;
+
+    if (FeaturePcdGet (PcdOmap35xxLcdDither)) {
+      LcdConvertRowToRgb565Dither (DestinationPixel16bit, EfiSourcePixel, Width, DestinationX, DestinationLine);
+    } else {
+      LcdConvertRowToRgb565 (DestinationPixel16bit, EfiSourcePixel, Width);
+    }
+  }
+
+  return Status;
+}
+
+//
+// 32bpp modes use the Blt pixel layout, so the Blt operations are plain copies and fills
+//
+
+STATIC
+VOID
+LcdCopyRectangle32 (
+  OUT VOID   *Destination,
+  IN  UINTN  DestinationPixelsPerLine,
+  IN  VOID   *Source,
+  IN  UINTN  SourcePixelsPerLine,
+  IN  UINTN  Width,
+  IN  UINTN  Height
+  )
+{
+  UINTN  Line;
+
+  for (Line = 0; Line < Height; Line++) {
+    CopyMem (
+      (UINT32 *)Destination + Line * DestinationPixelsPerLine,
+      (UINT32 *)Source + Line * SourcePixelsPerLine,
+      Width * sizeof (UINT32)
+      );
+  }
+}
+
+STATIC
+EFI_STATUS
+BltVideoFill32 (
+  IN EFI_GRAPHICS_OUTPUT_PROTOCOL        *This,
+  IN EFI_GRAPHICS_OUTPUT_BLT_PIXEL       *EfiSourcePixel,
+  IN UINTN                               DestinationX,
+  IN UINTN                               DestinationY,
+  IN UINTN                               Width,
+  IN UINTN                               Height
+  )
+{
+  UINT32  HorizontalResolution;
+  UINT32  *FrameBufferBase;
+  UINT32  Pixel32bit;
+  UINTN   Line;
+
+  HorizontalResolution = This->Mode->Info->HorizontalResolution;
+  FrameBufferBase = (UINT32 *)LcdGetBltFrameBuffer (This);
+
+  Pixel32bit = ((UINT32)EfiSourcePixel->Red << 16) | ((UINT32)EfiSourcePixel->Green << 8) | EfiSourcePixel->Blue;
+
+  if (!EFI_ERROR (LcdDmaFill (FrameBufferBase, FALSE, HorizontalResolution, 4, Pixel32bit,
+                              DestinationX, DestinationY, Width, Height))) {
+    return EFI_SUCCESS;
+  }
+
+  for (Line = DestinationY; Line < DestinationY + Height; Line++) {
+    SetMem32 (FrameBufferBase + Line * HorizontalResolution + DestinationX, Width * sizeof (UINT32), Pixel32bit);
+  }
+
+  return EFI_SUCCESS;
+}
+
+STATIC
+EFI_STATUS
+BltVideoToBltBuffer32 (
+  IN EFI_GRAPHICS_OUTPUT_PROTOCOL        *This,
+  IN OUT EFI_GRAPHICS_OUTPUT_BLT_PIXEL   *BltBuffer,
+  IN UINTN                               SourceX,
+  IN UINTN                               SourceY,
+  IN UINTN                               DestinationX,
+  IN UINTN                               DestinationY,
+  IN UINTN                               Width,
+  IN UINTN                               Height,
+  IN UINTN                               BltBufferHorizontalResolution
+  )
+{
+  UINT32  HorizontalResolution;
+  UINT32  *FrameBufferBase;
+
+  HorizontalResolution = This->Mode->Info->HorizontalResolution;
+  FrameBufferBase = (UINT32 *)LcdGetBltFrameBuffer (This);
+
+  LcdCopyRectangle32 (
+    BltBuffer + DestinationY * BltBufferHorizontalResolution + DestinationX, BltBufferHorizontalResolution,
+    FrameBufferBase + SourceY * HorizontalResolution + SourceX, HorizontalResolution,
+    Width, Height
+    );
+
+  return EFI_SUCCESS;
+}
+
+STATIC
+EFI_STATUS
+BltBufferToVideo32 (
+  IN EFI_GRAPHICS_OUTPUT_PROTOCOL        *This,
+  IN EFI_GRAPHICS_OUTPUT_BLT_PIXEL       *BltBuffer,
+  IN UINTN                               SourceX,
+  IN UINTN                               SourceY,
+  IN UINTN                               DestinationX,
+  IN UINTN                               DestinationY,
+  IN UINTN                               Width,
+  IN UINTN                               Height,
+  IN UINTN                               BltBufferHorizontalResolution
+  )
+{
+  UINT32  HorizontalResolution;
+  UINT32  *FrameBufferBase;
+
+  HorizontalResolution = This->Mode->Info->HorizontalResolution;
+  FrameBufferBase = (UINT32 *)LcdGetBltFrameBuffer (This);
+
+  LcdCopyRectangle32 (
+    FrameBufferBase + DestinationY * HorizontalResolution + DestinationX, HorizontalResolution,
+    BltBuffer + SourceY * BltBufferHorizontalResolution + SourceX, BltBufferHorizontalResolution,
+    Width, Height
+    );
+
+  return EFI_SUCCESS;
+}
+
+STATIC
+EFI_STATUS
+BltVideoToVideo (
+  IN EFI_GRAPHICS_OUTPUT_PROTOCOL        *This,
+  IN OUT EFI_GRAPHICS_OUTPUT_BLT_PIXEL   *BltBuffer,     OPTIONAL
+  IN UINTN                               SourceX,
+  IN UINTN                               SourceY,
+  IN UINTN                               DestinationX,
+  IN UINTN                               DestinationY,
+  IN UINTN                               Width,
+  IN UINTN                               Height,
+  IN UINTN                               Delta           OPTIONAL   // Number of BYTES in a row of the BltBuffer
+  )
+{
+  EFI_STATUS         Status;
+  UINT32             HorizontalResolution;
+  UINTN              BitsPerPixel;
+  VOID               *FrameBufferBase;
+
+  BitsPerPixel = LCD_BYTES_PER_PIXEL (This->Mode->Info) * 8;
+
+  HorizontalResolution = This->Mode->Info->HorizontalResolution;
+
+  //
+  // BltVideo to BltVideo:
+  //
+  //  Source is the Video Memory,
+  //  Destination is the Video Memory
+
+  FrameBufferBase = LcdGetBltFrameBuffer (This);
+
+  // Large rectangles are copied by the system DMA, when the overlap allows it
+  if ((SourceX != DestinationX) || (SourceY != DestinationY)) {
+    Status = LcdDmaCopy (FrameBufferBase, LcdBltOnShadow (This),
+                         HorizontalResolution, BitsPerPixel / 8, SourceX, SourceY, DestinationX, DestinationY, Width, Height);
+    if (Status != EFI_UNSUPPORTED) {
+      return Status;
+    }
+  }
+
+  // The UEFI spec currently states:
+  // "There is no limitation on the overlapping of the source and destination rectangles"
+  // Therefore, we must be careful to avoid overwriting the source data
+  if( SourceY == DestinationY ) {
+    // Copying within the same height, e.g. horizontal shift
+    if( SourceX == DestinationX ) {
+      // Nothing to do
+      Status = EFI_SUCCESS;
+    } else if( ((SourceX>DestinationX)?(SourceX - DestinationX):(DestinationX - SourceX)) < Width ) {
+      // There is overlap
+      Status = VideoCopyHorizontalOverlap (BitsPerPixel, FrameBufferBase, HorizontalResolution, SourceX, SourceY, DestinationX, DestinationY, Width, Height );
+    } else {
+      // No overlap
+      Status = VideoCopyNoHorizontalOverlap (BitsPerPixel, FrameBufferBase, HorizontalResolution, SourceX, SourceY, DestinationX, DestinationY, Width, Height );
+    }
+  } else {
+    // Copying from different heights
+    Status = VideoCopyNoHorizontalOverlap (BitsPerPixel, FrameBufferBase, HorizontalResolution, SourceX, SourceY, DestinationX, DestinationY, Width, Height );
+  }
+
+  return Status;
+}
+
+// Move a frame of FrameSize bytes Shift bytes further into a buffer of BufferSize bytes,
+// as a full screen scroll up does. The last Shift bytes of the old frame are kept at the
+// end of the new one, like a video to video Blt leaves them. When the buffer has no room
+// left the frame goes back to the start of the buffer.
+// When NewFrameContent is given it holds the scrolled frame, the bytes that have to be
+// written are taken from it instead of being read back from the buffer.
+STATIC
+VOID
+LcdSlideFrame (
+  IN     UINT8        *Buffer,
+  IN     UINTN        BufferSize,
+  IN OUT UINTN        *FrameOffset,
+  IN     UINTN        FrameSize,
+  IN     UINTN        Shift,
+  IN     CONST UINT8  *NewFrameContent  OPTIONAL
+  )
+{
+  UINT8  *OldFrame;
+  UINT8  *NewFrame;
+
+  OldFrame = Buffer + *FrameOffset;
+
+  if (*FrameOffset + Shift + FrameSize <= BufferSize) {
+    *FrameOffset += Shift;
+    NewFrame = Buffer + *FrameOffset;
+  } else {
+    *FrameOffset = 0;
+    NewFrame = Buffer;
+    if (NewFrameContent != NULL) {
+      CopyMem (NewFrame, NewFrameContent, FrameSize - Shift);
+    } else {
+      CopyMem (NewFrame, OldFrame + Shift, FrameSize - Shift);
+    }
+  }
+
+  if (NewFrameContent != NULL) {
+    CopyMem (NewFrame + FrameSize - Shift, NewFrameContent + FrameSize - Shift, Shift);
+  } else {
+    CopyMem (NewFrame + FrameSize - Shift, OldFrame + FrameSize - Shift, Shift);
+  }
+}
+
+// A video to video Blt of the whole screen width that moves everything up is a scroll
+STATIC
+BOOLEAN
+LcdIsScrollUp (
+  IN EFI_GRAPHICS_OUTPUT_PROTOCOL  *This,
+  IN UINTN                         SourceX,
+  IN UINTN                         SourceY,
+  IN UINTN                         DestinationX,
+  IN UINTN                         DestinationY,
+  IN UINTN                         Width,
+  IN UINTN                         Height
+  )
+{
+  if (!FeaturePcdGet (PcdOmap35xxLcdPanScroll) || (This->Mode->Info->PixelFormat != PixelBltOnly)) {
+    return FALSE;
+  }
+
+  return ((SourceX == 0) && (DestinationX == 0) && (DestinationY == 0) && (SourceY > 0) && (Height > 0) &&
+          (Width == This->Mode->Info->HorizontalResolution) &&
+          (SourceY + Height == This->Mode->Info->VerticalResolution));
+}
+
+// Scroll the screen up by Lines by moving the DSS graphics window down the VRAM. Only
+// the exposed lines are copied, unless the window has to go back to the start of the VRAM.
+STATIC
+EFI_STATUS
+LcdScrollUp (
+  IN LCD_INSTANCE  *Instance,
+  IN UINTN         Lines
+  )
+{
+  UINTN  FrameSize;
+  UINTN  Shift;
+  UINT8  *ShadowFrame;
+
+  FrameSize = Instance->ModeInfo.HorizontalResolution * Instance->ModeInfo.VerticalResolution * 2;
+  Shift = Lines * Instance->ModeInfo.HorizontalResolution * 2;
+
+  ShadowFrame = NULL;
+  if (Instance->ShadowFrameBuffer != NULL) {
+    // Bring the VRAM up to date, both copies then slide the same way. The VRAM is
+    // write-combined, what has to be copied into it is read from the shadow.
+    LcdFlushShadowFrameBuffer (Instance);
+    LcdSlideFrame (Instance->ShadowFrameBuffer, Instance->ShadowFrameBufferSize, &Instance->ShadowFrameOffset, FrameSize, Shift, NULL);
+    ShadowFrame = (UINT8 *)Instance->ShadowFrameBuffer + Instance->ShadowFrameOffset;
+  }
+
+  // The page flip back buffers sit at the end of the VRAM, the window stops before them
+  LcdSlideFrame (
+    (UINT8 *)(UINTN)Instance->Mode.FrameBufferBase,
+    (UINTN)(Instance->BackBufferBase - Instance->Mode.FrameBufferBase),
+    &Instance->FrameOffset,
+    FrameSize,
+    Shift,
+    ShadowFrame
+    );
+  ArmDataSynchronizationBarrier ();
+
+  // The DSS picks up the new base address at the next frame. While a page flip client
+  // shows one of its own buffers the scroll only changes buffer 0.
+  if ((Instance->PageFlip.DisplayedBuffer == 0) && (Instance->FlipBuffer == LCD_NO_FLIP)) {
+    MmioWrite32 (DISPC_GFX_BA0, (UINT32)Instance->Mode.FrameBufferBase + Instance->FrameOffset);
+    MmioOr32 (DISPC_CONTROL, GOLCD);
+  }
+
+  return EFI_SUCCESS;
+}
+
+EFI_STATUS
+EFIAPI
+LcdGraphicsBlt (
+  IN EFI_GRAPHICS_OUTPUT_PROTOCOL        *This,
+  IN OUT EFI_GRAPHICS_OUTPUT_BLT_PIXEL   *BltBuffer,     OPTIONAL
+  IN EFI_GRAPHICS_OUTPUT_BLT_OPERATION   BltOperation,
+  IN UINTN                               SourceX,
+  IN UINTN                               SourceY,
+  IN UINTN                               DestinationX,
+  IN UINTN                               DestinationY,
+  IN UINTN                               Width,
+  IN UINTN                               Height,
+  IN UINTN                               Delta           OPTIONAL   // Number of BYTES in a row of the BltBuffer
+  )
+{
+  EFI_STATUS    Status;
+  LCD_INSTANCE  *Instance;
+  EFI_TPL       OldTpl = TPL_APPLICATION;
+  UINTN         BltBufferHorizontalResolution;
+  BOOLEAN       Scrolled;
+
+  Instance = LCD_INSTANCE_FROM_GOP_THIS(This);
+
+  if (!mDisplayInitialized) {
+    InitializeDisplay (Instance);
+  }
+
+  // 32bpp modes have no shadow framebuffer and no conversion
+  if (LCD_BYTES_PER_PIXEL (This->Mode->Info) == 4) {
+    if ((Delta != 0) && (Delta != Width * sizeof (EFI_GRAPHICS_OUTPUT_BLT_PIXEL))) {
+      BltBufferHorizontalResolution = Delta / sizeof (EFI_GRAPHICS_OUTPUT_BLT_PIXEL);
+    } else {
+      BltBufferHorizontalResolution = Width;
+    }
+
+    switch (BltOperation) {
+    case EfiBltVideoFill:
+      Status = BltVideoFill32 (This, BltBuffer, DestinationX, DestinationY, Width, Height);
+      break;
+
+    case EfiBltVideoToBltBuffer:
+      Status = BltVideoToBltBuffer32 (This, BltBuffer, SourceX, SourceY, DestinationX, DestinationY, Width, Height, BltBufferHorizontalResolution);
+      break;
+
+    case EfiBltBufferToVideo:
+      Status = BltBufferToVideo32 (This, BltBuffer, SourceX, SourceY, DestinationX, DestinationY, Width, Height, BltBufferHorizontalResolution);
+      break;
+
+    case EfiBltVideoToVideo:
+      Status = BltVideoToVideo (This, BltBuffer, SourceX, SourceY, DestinationX, DestinationY, Width, Height, Delta);
+      break;
+
+    case EfiGraphicsOutputBltOperationMax:
+    default:
+      DEBUG((DEBUG_ERROR, "LcdGraphicsBlt: Invalid Operation\n"));
+      Status = EFI_INVALID_PARAMETER;
+      break;
+    }
+
+    return Status;
+  }
+
+  // Keep the flush timer away from the shadow and the dirty list while we update them
+  if (Instance->FlushEvent != NULL) {
+    OldTpl = gBS->RaiseTPL (TPL_NOTIFY);
+  }
+
+  Scrolled = FALSE;
+
+  switch (BltOperation) {
+  case EfiBltVideoFill:
+    Status = BltVideoFill (This, BltBuffer, SourceX, SourceY, DestinationX, DestinationY, Width, Height, Delta);
+    break;
+
+  case EfiBltVideoToBltBuffer:
+    Status = BltVideoToBltBuffer (This, BltBuffer, SourceX, SourceY, DestinationX, DestinationY, Width, Height, Delta);
+    break;
+
+  case EfiBltBufferToVideo:
+    Status = BltBufferToVideo (This, BltBuffer, SourceX, SourceY, DestinationX, DestinationY, Width, Height, Delta);
+    break;
+
+  case EfiBltVideoToVideo:
+    if (LcdIsScrollUp (This, SourceX, SourceY, DestinationX, DestinationY, Width, Height)) {
+      Status = LcdScrollUp (Instance, SourceY);
+      Scrolled = TRUE;
+    } else {
+      Status = BltVideoToVideo (This, BltBuffer, SourceX, SourceY, DestinationX, DestinationY, Width, Height, Delta);
+    }
+    break;
+
+  case EfiGraphicsOutputBltOperationMax:
+  default:
+    DEBUG((DEBUG_ERROR, "LcdGraphicsBlt: Invalid Operation\n"));
+    Status = EFI_INVALID_PARAMETER;
+    break;
+}
+
+  // A scroll updates the shadow and the VRAM together
+  if (!EFI_ERROR (Status) && (BltOperation != EfiBltVideoToBltBuffer) && !Scrolled) {
+    LcdMarkDirty (Instance, DestinationX, DestinationY, Width, Height);
+  }
+
+  if (Instance->FlushEvent != NULL) {
+    gBS->RestoreTPL (OldTpl);
+  } else {
+    LcdFlushShadowFrameBuffer (Instance);
+  }
+
+  return Status;
+}
@@ -0,0 +1,267 @@
+/** @file
+  System DMA backend for the OMAP LCD Blt operations.
+
+  Large fills and video to video copies are run by the sDMA as 2D transfers:
+  one frame per line of the rectangle, with the frame index skipping the rest
+  of the framebuffer line. Fills use the constant fill mode of the channel.
+  The transfer is started and waited for inside the Blt call, so the GOP
+  stays synchronous.
+
+  This program and the accompanying materials
+  are licensed and made available under the terms and conditions of the BSD License
+  which accompanies this distribution.  The full text of the license may be found at
+  http://opensource.org/licenses/bsd-license.php
+
+  THE PROGRAM IS DISTRIBUTED UNDER THE BSD LICENSE ON AN "AS IS" BASIS,
+  WITHOUT WARRANTIES OR REPRESENTATIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED.
+
+**/
+
+#include <Library/CacheMaintenanceLib.h>
+#include <Library/OmapDmaLib.h>
+#include <Library/TimerLib.h>
+
+#include "LcdGraphicsOutputDxe.h"
+
+// Longest wait for a transfer, a full 1024x768 32bpp frame takes a few ms
+#define LCD_DMA_TIMEOUT_US    100000
+
+// Longest wait for a stopped channel to finish its last burst
+#define LCD_DMA_DRAIN_US      100
+
+STATIC
+BOOLEAN
+LcdDmaWorthIt (
+  IN UINTN  Width,
+  IN UINTN  Height
+  )
+{
+  UINT32  Threshold;
+
+  Threshold = PcdGet32 (PcdOmap35xxLcdDmaThreshold);
+  if (Threshold == 0) {
+    return FALSE;
+  }
+
+  return (Width * Height >= Threshold);
+}
+
+// Clean and invalidate the lines of a rectangle of the cached shadow framebuffer
+STATIC
+VOID
+LcdDmaSyncRectangle (
+  IN VOID    *FrameBufferBase,
+  IN UINT32  HorizontalResolution,
+  IN UINTN   BytesPerPixel,
+  IN UINTN   X,
+  IN UINTN   Y,
+  IN UINTN   Width,
+  IN UINTN   Height
+  )
+{
+  WriteBackInvalidateDataCacheRange (
+    (UINT8 *)FrameBufferBase + (Y * HorizontalResolution + X) * BytesPerPixel,
+    ((Height - 1) * HorizontalResolution + Width) * BytesPerPixel
+    );
+}
+
+// Wait for the transfer to end. A channel that is not done in time is stopped and
+// EFI_TIMEOUT returned, the Blt is then done by the CPU.
+STATIC
+EFI_STATUS
+LcdDmaWait (
+  VOID
+  )
+{
+  UINT64  StartValue;
+  UINT64  EndValue;
+  UINT64  Timeout;
+  UINT64  Elapsed;
+  UINT64  Last;
+  UINT64  Now;
+  UINTN   Drain;
+
+  Timeout = DivU64x32 (MultU64x32 (GetPerformanceCounterProperties (&StartValue, &EndValue), LCD_DMA_TIMEOUT_US), 1000000) + 1;
+  Elapsed = 0;
+  Last = GetPerformanceCounter ();
+
+  while ((MmioRead32 (DMA4_CSR (LCD_DMA_CHANNEL)) & (DMA4_CSR_BLOCK | DMA4_CSR_ERR)) == 0) {
+    if (Elapsed >= Timeout) {
+      DEBUG((DEBUG_ERROR, "LcdDmaWait: Timeout, CSR=%x\n", MmioRead32 (DMA4_CSR (LCD_DMA_CHANNEL))));
+
+      MmioAnd32 (DMA4_CCR (LCD_DMA_CHANNEL), ~DMA4_CCR_ENABLE);
+      for (Drain = 0; Drain < LCD_DMA_DRAIN_US; Drain++) {
+        if ((MmioRead32 (DMA4_CCR (LCD_DMA_CHANNEL)) & (DMA4_CCR_RD_ACTIVE | DMA4_CCR_WR_ACTIVE)) == 0) {
+          break;
+        }
+        MicroSecondDelay (1);
+      }
+
+      MmioWrite32 (DMA4_CICR (LCD_DMA_CHANNEL), 0);
+      MmioWrite32 (DMA4_CSR (LCD_DMA_CHANNEL), DMA4_CSR_RESET);
+      return EFI_TIMEOUT;
+    }
+
+    Now = GetPerformanceCounter ();
+    if (EndValue >= StartValue) {
+      Elapsed += (Now >= Last) ? (Now - Last) : ((EndValue - Last) + (Now - StartValue) + 1);
+    } else {
+      Elapsed += (Now <= Last) ? (Last - Now) : ((Last - EndValue) + (StartValue - Now) + 1);
+    }
+    Last = Now;
+  }
+
+  // The channel is done, this only checks for errors and turns it off
+  return DisableDmaChannel (LCD_DMA_CHANNEL, DMA4_CSR_BLOCK, DMA4_CSR_ERR);
+}
+
+STATIC
+EFI_STATUS
+LcdDmaTransfer (
+  IN VOID     *FrameBufferBase,
+  IN BOOLEAN  Cached,
+  IN UINT32   HorizontalResolution,
+  IN UINTN    BytesPerPixel,
+  IN BOOLEAN  Fill,
+  IN UINT32   Pixel,
+  IN UINTN    SourceX,
+  IN UINTN    SourceY,
+  IN UINTN    DestinationX,
+  IN UINTN    DestinationY,
+  IN UINTN    Width,
+  IN UINTN    Height
+  )
+{
+  OMAP_DMA4   Dma4;
+  EFI_STATUS  Status;
+  UINT32      FrameIndex;
+
+  // The DMA works on physical memory, write back what the CPU has in its cache.
+  // Uncached and write-combined VRAM writes may still sit in the write buffer.
+  if (Cached) {
+    if (!Fill) {
+      LcdDmaSyncRectangle (FrameBufferBase, HorizontalResolution, BytesPerPixel, SourceX, SourceY, Width, Height);
+    }
+    LcdDmaSyncRectangle (FrameBufferBase, HorizontalResolution, BytesPerPixel, DestinationX, DestinationY, Width, Height);
+  } else {
+    ArmDataSynchronizationBarrier ();
+  }
+
+  // Skip from the end of a line of the rectangle to the start of the next one
+  FrameIndex = (UINT32)((HorizontalResolution - Width) * BytesPerPixel + 1);
+
+  ZeroMem (&Dma4, sizeof (OMAP_DMA4));
+
+  Dma4.DataType = (BytesPerPixel == 4) ? DMA4_CSDP_DATA_TYPE32 : DMA4_CSDP_DATA_TYPE16;  // DMA4_CSDPi[1:0]  One pixel per element
+  Dma4.ReadPortAccessType = 3;            // DMA4_CSDPi[8:7]   Burst 16x32
+  Dma4.WritePortAccessType = 3;           // DMA4_CSDPi[15:14] Burst 16x32
+  Dma4.WriteMode = 1;                     // DMA4_CSDPi[17:16] Write posted
+  Dma4.SourcePacked = 1;                  // DMA4_CSDPi[6]
+  Dma4.DestinationPacked = 1;             // DMA4_CSDPi[13]
+  Dma4.NumberOfElementPerFrame = (UINT32)Width;         // DMA4_CENi
+  Dma4.NumberOfFramePerTransferBlock = (UINT32)Height;  // DMA4_CFNi
+  Dma4.SourceStartAddress = (UINT32)(UINTN)((UINT8 *)FrameBufferBase + (SourceY * HorizontalResolution + SourceX) * BytesPerPixel);                // DMA4_CSSAi
+  Dma4.DestinationStartAddress = (UINT32)(UINTN)((UINT8 *)FrameBufferBase + (DestinationY * HorizontalResolution + DestinationX) * BytesPerPixel); // DMA4_CDSAi
+  Dma4.SourceElementIndex = 1;            // DMA4_CSEi
+  Dma4.SourceFrameIndex = FrameIndex;     // DMA4_CSFi
+  Dma4.DestinationElementIndex = 1;       // DMA4_CDEi
+  Dma4.DestinationFrameIndex = FrameIndex;  // DMA4_CDFi
+  Dma4.ReadPortAccessMode = 3;            // DMA4_CCRi[13:12]  Double index
+  Dma4.WritePortAccessMode = 3;           // DMA4_CCRi[15:14]  Double index
+
+  // Software triggered block transfer. EnableDmaChannel() preserves these CCR bits.
+  // The color register is 24 bits wide, 32bpp pixels are filled with a zero X byte
+  if (Fill) {
+    MmioWrite32 (DMA4_COLOR (LCD_DMA_CHANNEL), Pixel);
+  }
+  MmioAndThenOr32 (
+    DMA4_CCR (LCD_DMA_CHANNEL),
+    ~(DMA4_CCR_FS_PACKET | DMA4_CCR_SEL_SRC_DEST_SYNC_SOURCE | DMA4_CCR_CONST_FILL_ENABLE | DMA4_CCR_TRANSPARENT_COPY_ENABLE),
+    Fill ? DMA4_CCR_CONST_FILL_ENABLE : 0
+    );
+
+  Status = EnableDmaChannel (LCD_DMA_CHANNEL, &Dma4);
+  if (!EFI_ERROR (Status)) {
+    Status = LcdDmaWait ();
+  }
+
+  // Drop lines the CPU may have speculatively loaded during the transfer
+  if (Cached) {
+    LcdDmaSyncRectangle (FrameBufferBase, HorizontalResolution, BytesPerPixel, DestinationX, DestinationY, Width, Height);
+  }
+
+  if (EFI_ERROR (Status)) {
+    DEBUG((DEBUG_ERROR, "LcdDmaTransfer: DMA failed. Status=%r\n", Status));
+  }
+
+  return Status;
+}
+
+// Returns EFI_UNSUPPORTED when the CPU should do the fill instead
+EFI_STATUS
+LcdDmaFill (
+  IN VOID     *FrameBufferBase,
+  IN BOOLEAN  Cached,
+  IN UINT32   HorizontalResolution,
+  IN UINTN    BytesPerPixel,
+  IN UINT32   Pixel,
+  IN UINTN    DestinationX,
+  IN UINTN    DestinationY,
+  IN UINTN    Width,
+  IN UINTN    Height
+  )
+{
+  if (!LcdDmaWorthIt (Width, Height)) {
+    return EFI_UNSUPPORTED;
+  }
+
+  // Filling again is harmless, a failed transfer is redone by the CPU
+  if (EFI_ERROR (LcdDmaTransfer (FrameBufferBase, Cached, HorizontalResolution, BytesPerPixel, TRUE, Pixel,
+                                 0, 0, DestinationX, DestinationY, Width, Height))) {
+    return EFI_UNSUPPORTED;
+  }
+
+  return EFI_SUCCESS;
+}
+
+// Returns EFI_UNSUPPORTED when the CPU should do the copy instead. A failed transfer
+// between overlapping rectangles may already have overwritten part of the source,
+// it is reported as EFI_DEVICE_ERROR because copying again would not be right.
+EFI_STATUS
+LcdDmaCopy (
+  IN VOID     *FrameBufferBase,
+  IN BOOLEAN  Cached,
+  IN UINT32   HorizontalResolution,
+  IN UINTN    BytesPerPixel,
+  IN UINTN    SourceX,
+  IN UINTN    SourceY,
+  IN UINTN    DestinationX,
+  IN UINTN    DestinationY,
+  IN UINTN    Width,
+  IN UINTN    Height
+  )
+{
+  BOOLEAN     Overlap;
+  EFI_STATUS  Status;
+
+  if (!LcdDmaWorthIt (Width, Height)) {
+    return EFI_UNSUPPORTED;
+  }
+
+  // The DMA always walks the rectangle forwards, so overlapping rectangles can only
+  // be copied when the destination comes before the source in memory
+  Overlap = (SourceX < DestinationX + Width) && (DestinationX < SourceX + Width) &&
+            (SourceY < DestinationY + Height) && (DestinationY < SourceY + Height);
+  if (Overlap &&
+      ((DestinationY > SourceY) || ((DestinationY == SourceY) && (DestinationX > SourceX)))) {
+    return EFI_UNSUPPORTED;
+  }
+
+  Status = LcdDmaTransfer (FrameBufferBase, Cached, HorizontalResolution, BytesPerPixel, FALSE, 0,
+                           SourceX, SourceY, DestinationX, DestinationY, Width, Height);
+  if (EFI_ERROR (Status)) {
+    return Overlap ? EFI_DEVICE_ERROR : EFI_UNSUPPORTED;
+  }
+
+  return EFI_SUCCESS;
+}
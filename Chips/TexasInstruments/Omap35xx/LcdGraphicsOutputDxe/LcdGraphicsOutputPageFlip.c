@@ -0,0 +1,250 @@
+/** @file
+  Page flipping for the OMAP LCD graphics output driver.
+
+  A flip is queued by the caller and carried out from the DSS VSYNC interrupt:
+  the first VSYNC loads the new buffer into DISPC_GFX_BA0 and sets GOLCD, the
+  DSS takes it at the start of the next frame and clears GOLCD, and the VSYNC
+  after that completes the flip. Without the interrupt the flip is done by
+  polling GOLCD.
+
+  This program and the accompanying materials
+  are licensed and made available under the terms and conditions of the BSD License
+  which accompanies this distribution.  The full text of the license may be found at
+  http://opensource.org/licenses/bsd-license.php
+
+  THE PROGRAM IS DISTRIBUTED UNDER THE BSD LICENSE ON AN "AS IS" BASIS,
+  WITHOUT WARRANTIES OR REPRESENTATIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED.
+
+**/
+
+#include "LcdGraphicsOutputDxe.h"
+
+// Longest wait for the DSS to take a new base address, a few frames at any mode
+#define LCD_FLIP_TIMEOUT_US   100000
+
+// The interrupt handler has no context
+STATIC LCD_INSTANCE *mLcdPageFlipInstance = NULL;
+
+STATIC
+EFI_PHYSICAL_ADDRESS
+LcdPageFlipBufferAddress (
+  IN LCD_INSTANCE  *Instance,
+  IN UINTN         BufferIndex
+  )
+{
+  UINTN  FrameSize;
+
+  if (BufferIndex == 0) {
+    return Instance->Mode.FrameBufferBase + Instance->FrameOffset;
+  }
+
+  FrameSize = Instance->ModeInfo.HorizontalResolution * Instance->ModeInfo.VerticalResolution
+              * LCD_BYTES_PER_PIXEL (&Instance->ModeInfo);
+
+  return Instance->BackBufferBase + (BufferIndex - 1) * FrameSize;
+}
+
+// Called at TPL_HIGH_LEVEL, from the interrupt or from the polling loop
+STATIC
+VOID
+LcdPageFlipOnVsync (
+  IN LCD_INSTANCE  *Instance
+  )
+{
+  if (Instance->FlipBuffer == LCD_NO_FLIP) {
+    return;
+  }
+
+  if (!Instance->FlipLoaded) {
+    MmioWrite32 (DISPC_GFX_BA0, (UINT32)LcdPageFlipBufferAddress (Instance, Instance->FlipBuffer));
+    MmioOr32 (DISPC_CONTROL, GOLCD);
+    Instance->FlipLoaded = TRUE;
+    return;
+  }
+
+  // GOLCD stays set until the DSS has loaded the new address
+  if ((MmioRead32 (DISPC_CONTROL) & GOLCD) != 0) {
+    return;
+  }
+
+  Instance->PageFlip.DisplayedBuffer = Instance->FlipBuffer;
+  Instance->FlipBuffer = LCD_NO_FLIP;
+  Instance->FlipLoaded = FALSE;
+
+  if (Instance->VsyncInterrupt) {
+    MmioAnd32 (DISPC_IRQENABLE, ~VSYNC);
+  }
+
+  if (Instance->FlipEvent != NULL) {
+    gBS->SignalEvent (Instance->FlipEvent);
+    Instance->FlipEvent = NULL;
+  }
+}
+
+VOID
+EFIAPI
+LcdVsyncInterruptHandler (
+  IN  HARDWARE_INTERRUPT_SOURCE   Source,
+  IN  EFI_SYSTEM_CONTEXT          SystemContext
+  )
+{
+  EFI_TPL  OldTpl;
+
+  OldTpl = gBS->RaiseTPL (TPL_HIGH_LEVEL);
+
+  if ((MmioRead32 (DISPC_IRQSTATUS) & VSYNC) != 0) {
+    MmioWrite32 (DISPC_IRQSTATUS, VSYNC);
+    if (mLcdPageFlipInstance != NULL) {
+      LcdPageFlipOnVsync (mLcdPageFlipInstance);
+    }
+  }
+
+  gBS->RestoreTPL (OldTpl);
+}
+
+EFI_STATUS
+EFIAPI
+LcdPageFlipGetBuffer (
+  IN  OMAP_PAGE_FLIP_PROTOCOL  *This,
+  IN  UINTN                    BufferIndex,
+  OUT EFI_PHYSICAL_ADDRESS     *Address
+  )
+{
+  LCD_INSTANCE  *Instance;
+
+  Instance = LCD_INSTANCE_FROM_PAGE_FLIP_THIS(This);
+
+  if ((Address == NULL) || (BufferIndex >= This->BufferCount)) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  *Address = LcdPageFlipBufferAddress (Instance, BufferIndex);
+  return EFI_SUCCESS;
+}
+
+EFI_STATUS
+EFIAPI
+LcdPageFlipFlip (
+  IN OMAP_PAGE_FLIP_PROTOCOL  *This,
+  IN UINTN                    BufferIndex,
+  IN EFI_EVENT                Event       OPTIONAL
+  )
+{
+  LCD_INSTANCE  *Instance;
+  EFI_TPL       OldTpl;
+  UINTN         Timeout;
+
+  Instance = LCD_INSTANCE_FROM_PAGE_FLIP_THIS(This);
+
+  if (BufferIndex >= This->BufferCount) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  OldTpl = gBS->RaiseTPL (TPL_HIGH_LEVEL);
+
+  if (Instance->FlipBuffer != LCD_NO_FLIP) {
+    gBS->RestoreTPL (OldTpl);
+    return EFI_NOT_READY;
+  }
+
+  Instance->FlipBuffer = BufferIndex;
+  Instance->FlipLoaded = FALSE;
+  Instance->FlipEvent = Event;
+
+  if (Instance->VsyncInterrupt) {
+    MmioWrite32 (DISPC_IRQSTATUS, VSYNC);
+    MmioOr32 (DISPC_IRQENABLE, VSYNC);
+    gBS->RestoreTPL (OldTpl);
+    return EFI_SUCCESS;
+  }
+
+  // No interrupt: load the address now and wait for the DSS to take it. The wait is
+  // done at the TPL of the caller, only the register updates are made at TPL_HIGH_LEVEL.
+  LcdPageFlipOnVsync (Instance);
+  for (Timeout = 0; (Instance->FlipBuffer != LCD_NO_FLIP) && (Timeout < LCD_FLIP_TIMEOUT_US); Timeout += 10) {
+    gBS->RestoreTPL (OldTpl);
+    gBS->Stall (10);
+    OldTpl = gBS->RaiseTPL (TPL_HIGH_LEVEL);
+    LcdPageFlipOnVsync (Instance);
+  }
+
+  if (Instance->FlipBuffer != LCD_NO_FLIP) {
+    // The DSS is not running, the address is used when it starts again
+    DEBUG((DEBUG_ERROR, "LcdPageFlipFlip: Timeout waiting for the DSS\n"));
+    Instance->PageFlip.DisplayedBuffer = BufferIndex;
+    Instance->FlipBuffer = LCD_NO_FLIP;
+    Instance->FlipLoaded = FALSE;
+    if (Event != NULL) {
+      gBS->SignalEvent (Event);
+    }
+    Instance->FlipEvent = NULL;
+  }
+
+  gBS->RestoreTPL (OldTpl);
+  return EFI_SUCCESS;
+}
+
+// Drop any queued flip and lay out the back buffers for the new mode. Called when the
+// mode is set, before the DSS is programmed again and points back to buffer 0.
+VOID
+LcdPageFlipReset (
+  IN LCD_INSTANCE  *Instance
+  )
+{
+  EFI_TPL  OldTpl;
+  UINTN    FrameSize;
+  UINTN    BackBuffers;
+
+  OldTpl = gBS->RaiseTPL (TPL_HIGH_LEVEL);
+
+  // The VSYNC interrupt is only enabled while a flip is queued, so the DSS clocks are running
+  if (Instance->VsyncInterrupt && (Instance->FlipBuffer != LCD_NO_FLIP)) {
+    MmioAnd32 (DISPC_IRQENABLE, ~VSYNC);
+  }
+  Instance->FlipBuffer = LCD_NO_FLIP;
+  Instance->FlipLoaded = FALSE;
+  Instance->FlipEvent = NULL;
+  Instance->PageFlip.DisplayedBuffer = 0;
+
+  FrameSize = Instance->ModeInfo.HorizontalResolution * Instance->ModeInfo.VerticalResolution
+              * LCD_BYTES_PER_PIXEL (&Instance->ModeInfo);
+
+  // Keep at least one frame in front of the back buffers for the GOP framebuffer
+  BackBuffers = PcdGet32 (PcdOmap35xxLcdBackBuffers);
+  while ((BackBuffers > 0) && ((BackBuffers + 1) * FrameSize + EFI_PAGE_SIZE > Instance->VramSize)) {
+    BackBuffers--;
+  }
+
+  Instance->BackBufferBase = (Instance->Mode.FrameBufferBase + Instance->VramSize - BackBuffers * FrameSize)
+                             & ~((EFI_PHYSICAL_ADDRESS)EFI_PAGE_MASK);
+  Instance->PageFlip.BufferCount = BackBuffers + 1;
+
+  gBS->RestoreTPL (OldTpl);
+}
+
+VOID
+LcdPageFlipInitialize (
+  IN LCD_INSTANCE  *Instance
+  )
+{
+  EFI_HARDWARE_INTERRUPT_PROTOCOL *Interrupt;
+  EFI_STATUS                      Status;
+
+  Instance->PageFlip.GetBuffer = LcdPageFlipGetBuffer;
+  Instance->PageFlip.Flip = LcdPageFlipFlip;
+  Instance->FlipBuffer = LCD_NO_FLIP;
+  mLcdPageFlipInstance = Instance;
+
+  // The DSS clocks are not running yet, DssSetMode masks VSYNC once they are
+  Status = gBS->LocateProtocol (&gHardwareInterruptProtocolGuid, NULL, (VOID **)&Interrupt);
+  if (!EFI_ERROR (Status)) {
+    Status = Interrupt->RegisterInterruptSource (Interrupt, DSS_IRQ, LcdVsyncInterruptHandler);
+  }
+
+  if (EFI_ERROR (Status)) {
+    DEBUG((DEBUG_ERROR, "LcdPageFlipInitialize: No VSYNC interrupt, flips will be polled. Status=%r\n", Status));
+    return;
+  }
+
+  Instance->VsyncInterrupt = TRUE;
+}
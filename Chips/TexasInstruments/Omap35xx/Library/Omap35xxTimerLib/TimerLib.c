@@ -1,133 +1,177 @@
-/** @file
-
-  Copyright (c) 2008 - 2009, Apple Inc. All rights reserved.<BR>
-
-  This program and the accompanying materials
-  are licensed and made available under the terms and conditions of the BSD License
-  which accompanies this distribution.  The full text of the license may be found at
-  http://opensource.org/licenses/bsd-license.php
-
-  THE PROGRAM IS DISTRIBUTED UNDER THE BSD LICENSE ON AN "AS IS" BASIS,
-  WITHOUT WARRANTIES OR REPRESENTATIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED.
-
-**/
-
-#include <Uefi.h>
-
-#include <Library/BaseLib.h>
-#include <Library/TimerLib.h>
-#include <Library/DebugLib.h>
-#include <Library/PcdLib.h>
-#include <Library/IoLib.h>
-#include <Library/OmapLib.h>
-
-#include <Omap3530/Omap3530.h>
-
-RETURN_STATUS
-EFIAPI
-TimerConstructor (
-  VOID
-  )
-{
-  UINTN  Timer            = PcdGet32(PcdOmap35xxFreeTimer);
-  UINT32 TimerBaseAddress = TimerBase(Timer);
-
-  if ((MmioRead32 (TimerBaseAddress + GPTIMER_TCLR) & TCLR_ST_ON) == 0) {
-    // Set source clock for GPT3 & GPT4 to SYS_CLK
-    MmioOr32 (CM_CLKSEL_PER, CM_CLKSEL_PER_CLKSEL_GPT3_SYS | CM_CLKSEL_PER_CLKSEL_GPT4_SYS);
-
-    // Set count & reload registers
-    MmioWrite32 (TimerBaseAddress + GPTIMER_TCRR, 0x00000000);
-    MmioWrite32 (TimerBaseAddress + GPTIMER_TLDR, 0x00000000);
-
-    // Disable interrupts
-    MmioWrite32 (TimerBaseAddress + GPTIMER_TIER, TIER_TCAR_IT_DISABLE | TIER_OVF_IT_DISABLE | TIER_MAT_IT_DISABLE);
-
-    // Start Timer
-    MmioWrite32 (TimerBaseAddress + GPTIMER_TCLR, TCLR_AR_AUTORELOAD | TCLR_ST_ON);
-
-    // Disable OMAP Watchdog timer (WDT2)
-    MmioWrite32 (WDTIMER2_BASE + WSPR, 0xAAAA);
-    DEBUG ((EFI_D_ERROR, "Magic delay to disable watchdog timers properly.\n"));
-    MmioWrite32 (WDTIMER2_BASE + WSPR, 0x5555);
-  }
-  return EFI_SUCCESS;
-}
-
-UINTN
-EFIAPI
-MicroSecondDelay (
-  IN  UINTN MicroSeconds
-  )
-{
-  UINT64  NanoSeconds;
-
-  NanoSeconds = MultU64x32(MicroSeconds, 1000);
-
-  while (NanoSeconds > (UINTN)-1) {
-    NanoSecondDelay((UINTN)-1);
-    NanoSeconds -= (UINTN)-1;
-  }
-
-  NanoSecondDelay(NanoSeconds);
-
-  return MicroSeconds;
-}
-
-UINTN
-EFIAPI
-NanoSecondDelay (
-  IN  UINTN NanoSeconds
-  )
-{
-  UINT32  Delay;
-  UINT32  StartTime;
-  UINT32  CurrentTime;
-  UINT32  ElapsedTime;
-  UINT32  TimerCountRegister;
-
-  Delay = (NanoSeconds / PcdGet32(PcdEmbeddedPerformanceCounterPeriodInNanoseconds)) + 1;
-
-  TimerCountRegister = TimerBase(PcdGet32(PcdOmap35xxFreeTimer)) + GPTIMER_TCRR;
-
-  StartTime = MmioRead32 (TimerCountRegister);
-
-  do
-  {
-    CurrentTime = MmioRead32 (TimerCountRegister);
-    ElapsedTime = CurrentTime - StartTime;
-  } while (ElapsedTime < Delay);
-
-  NanoSeconds = ElapsedTime * PcdGet32(PcdEmbeddedPerformanceCounterPeriodInNanoseconds);
-
-  return NanoSeconds;
-}
-
-UINT64
-EFIAPI
-GetPerformanceCounter (
-  VOID
-  )
-{
-  return (UINT64)MmioRead32 (TimerBase(PcdGet32(PcdOmap35xxFreeTimer)) + GPTIMER_TCRR);
-}
-
-UINT64
-EFIAPI
-GetPerformanceCounterProperties (
-  OUT UINT64  *StartValue,  OPTIONAL
-  OUT UINT64  *EndValue     OPTIONAL
-  )
-{
-  if (StartValue != NULL) {
-    // Timer starts with the reload value
-    *StartValue = (UINT64)MmioRead32 (TimerBase(PcdGet32(PcdOmap35xxFreeTimer)) + GPTIMER_TLDR);
-  }
-
-  if (EndValue != NULL) {
-    // Timer counts up to 0xFFFFFFFF
-    *EndValue = 0xFFFFFFFF;
-  }
-
-  return PcdGet64(PcdEmbeddedPerformanceCounterFrequencyInHz);
-}
+/** @file
+
+  Copyright (c) 2008 - 2009, Apple Inc. All rights reserved.<BR>
+
+  This program and the accompanying materials
+  are licensed and made available under the terms and conditions of the BSD License
+  which accompanies this distribution.  The full text of the license may be found at
+  http://opensource.org/licenses/bsd-license.php
+
+  THE PROGRAM IS DISTRIBUTED UNDER THE BSD LICENSE ON AN "AS IS" BASIS,
+  WITHOUT WARRANTIES OR REPRESENTATIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED.
+
+**/
+
+#include <Uefi.h>
+
+#include <Library/BaseLib.h>
+#include <Library/TimerLib.h>
+#include <Library/DebugLib.h>
+#include <Library/PcdLib.h>
+#include <Library/IoLib.h>
+#include <Library/OmapLib.h>
+
+#include <Omap3530/Omap3530.h>
+
+// Timer ticks per nanosecond in 32.32 fixed point, rounded up. 0 until first used.
+STATIC UINT64  mTicksPerNanoSecond = 0;
+
+RETURN_STATUS
+EFIAPI
+TimerConstructor (
+  VOID
+  )
+{
+  UINTN  Timer            = PcdGet32(PcdOmap35xxFreeTimer);
+  UINT32 TimerBaseAddress = TimerBase(Timer);
+
+  if ((MmioRead32 (TimerBaseAddress + GPTIMER_TCLR) & TCLR_ST_ON) == 0) {
+    // Set source clock for GPT3 & GPT4 to SYS_CLK
+    MmioOr32 (CM_CLKSEL_PER, CM_CLKSEL_PER_CLKSEL_GPT3_SYS | CM_CLKSEL_PER_CLKSEL_GPT4_SYS);
+
+    // Set count & reload registers
+    MmioWrite32 (TimerBaseAddress + GPTIMER_TCRR, 0x00000000);
+    MmioWrite32 (TimerBaseAddress + GPTIMER_TLDR, 0x00000000);
+
+    // Clear the upper half of the performance counter
+    MmioWrite32 (TimerBaseAddress + GPTIMER_TMAR, 0x00000000);
+    MmioWrite32 (TimerBaseAddress + GPTIMER_TISR, TISR_CLEAR_ALL);
+
+    // Disable interrupts
+    MmioWrite32 (TimerBaseAddress + GPTIMER_TIER, TIER_TCAR_IT_DISABLE | TIER_OVF_IT_DISABLE | TIER_MAT_IT_DISABLE);
+
+    // Start Timer
+    MmioWrite32 (TimerBaseAddress + GPTIMER_TCLR, TCLR_AR_AUTORELOAD | TCLR_ST_ON);
+
+    // Disable OMAP Watchdog timer (WDT2)
+    MmioWrite32 (WDTIMER2_BASE + WSPR, 0xAAAA);
+    DEBUG ((EFI_D_ERROR, "Magic delay to disable watchdog timers properly.\n"));
+    MmioWrite32 (WDTIMER2_BASE + WSPR, 0x5555);
+  }
+  return EFI_SUCCESS;
+}
+
+UINTN
+EFIAPI
+MicroSecondDelay (
+  IN  UINTN MicroSeconds
+  )
+{
+  UINT64  NanoSeconds;
+
+  NanoSeconds = MultU64x32(MicroSeconds, 1000);
+
+  while (NanoSeconds > (UINTN)-1) {
+    NanoSecondDelay((UINTN)-1);
+    NanoSeconds -= (UINTN)-1;
+  }
+
+  NanoSecondDelay(NanoSeconds);
+
+  return MicroSeconds;
+}
+
+UINTN
+EFIAPI
+NanoSecondDelay (
+  IN  UINTN NanoSeconds
+  )
+{
+  UINT32  Delay;
+  UINT32  StartTime;
+  UINT32  CurrentTime;
+  UINT32  ElapsedTime;
+  UINT32  TimerCountRegister;
+
+  // The divide is done once, a delay only multiplies and shifts
+  if (mTicksPerNanoSecond == 0) {
+    mTicksPerNanoSecond = DivU64x32 (
+                            LShiftU64 (PcdGet64 (PcdEmbeddedPerformanceCounterFrequencyInHz), 32) + 999999999,
+                            1000000000
+                            );
+  }
+
+  Delay = (UINT32)RShiftU64 (MultU64x64 (NanoSeconds, mTicksPerNanoSecond), 32) + 1;
+
+  TimerCountRegister = TimerBase(PcdGet32(PcdOmap35xxFreeTimer)) + GPTIMER_TCRR;
+
+  StartTime = MmioRead32 (TimerCountRegister);
+
+  do
+  {
+    CurrentTime = MmioRead32 (TimerCountRegister);
+    ElapsedTime = CurrentTime - StartTime;
+  } while (ElapsedTime < Delay);
+
+  NanoSeconds = ElapsedTime * PcdGet32(PcdEmbeddedPerformanceCounterPeriodInNanoseconds);
+
+  return NanoSeconds;
+}
+
+// The GPTIMER counts 32 bits. The upper half of the performance counter is kept in
+// the match register of the timer, compare is never enabled, so every module that
+// links this library sees the same counter. A wrap sets the overflow flag and the
+// next read advances the upper half. TimerDxe reads the counter on every tick so
+// no two wraps go by unseen.
+UINT64
+EFIAPI
+GetPerformanceCounter (
+  VOID
+  )
+{
+  UINT32   TimerBaseAddress;
+  BOOLEAN  InterruptState;
+  UINT32   Low;
+  UINT32   High;
+
+  TimerBaseAddress = TimerBase(PcdGet32(PcdOmap35xxFreeTimer));
+
+  // A caller that interrupts another one must not advance the upper half twice
+  InterruptState = SaveAndDisableInterrupts ();
+
+  Low = MmioRead32 (TimerBaseAddress + GPTIMER_TCRR);
+  High = MmioRead32 (TimerBaseAddress + GPTIMER_TMAR);
+
+  if ((MmioRead32 (TimerBaseAddress + GPTIMER_TISR) & TISR_OVF_IT_FLAG_MASK) != 0) {
+    // The wrap may have come after the first read, read the count again
+    Low = MmioRead32 (TimerBaseAddress + GPTIMER_TCRR);
+    High++;
+
+    MmioWrite32 (TimerBaseAddress + GPTIMER_TISR, TISR_OVF_IT_FLAG_CLEAR);
+    MmioWrite32 (TimerBaseAddress + GPTIMER_TMAR, High);
+    while ((MmioRead32 (TimerBaseAddress + GPTIMER_TWPS) & TWPS_W_PEND_TMAR) != 0);
+  }
+
+  SetInterruptState (InterruptState);
+
+  return LShiftU64 (High, 32) | Low;
+}
+
+UINT64
+EFIAPI
+GetPerformanceCounterProperties (
+  OUT UINT64  *StartValue,  OPTIONAL
+  OUT UINT64  *EndValue     OPTIONAL
+  )
+{
+  // The timer reloads with 0, extended to 64 bits the counter does not wrap
+  if (StartValue != NULL) {
+    *StartValue = 0;
+  }
+
+  if (EndValue != NULL) {
+    *EndValue = MAX_UINT64;
+  }
+
+  return PcdGet64(PcdEmbeddedPerformanceCounterFrequencyInHz);
+}
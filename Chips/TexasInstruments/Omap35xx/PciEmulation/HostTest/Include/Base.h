@@ -0,0 +1,105 @@
+/** @file
+  Host build of the MdePkg base types the PciEmulation sources use.
+
+  This program and the accompanying materials
+  are licensed and made available under the terms and conditions of the BSD License
+  which accompanies this distribution.  The full text of the license may be found at
+  http://opensource.org/licenses/bsd-license.php
+
+  THE PROGRAM IS DISTRIBUTED UNDER THE BSD LICENSE ON AN "AS IS" BASIS,
+  WITHOUT WARRANTIES OR REPRESENTATIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED.
+
+**/
+
+#ifndef __HOST_BASE_H__
+#define __HOST_BASE_H__
+
+#include <stddef.h>
+#include <stdint.h>
+
+typedef uint8_t       UINT8;
+typedef int8_t        INT8;
+typedef uint16_t      UINT16;
+typedef int16_t       INT16;
+typedef uint32_t      UINT32;
+typedef int32_t       INT32;
+typedef uint64_t      UINT64;
+typedef int64_t       INT64;
+typedef uintptr_t     UINTN;
+typedef intptr_t      INTN;
+typedef unsigned char BOOLEAN;
+typedef char          CHAR8;
+typedef uint16_t      CHAR16;
+typedef void          VOID;
+
+typedef struct {
+  UINT32  Data1;
+  UINT16  Data2;
+  UINT16  Data3;
+  UINT8   Data4[8];
+} GUID;
+
+typedef UINTN RETURN_STATUS;
+
+#define IN
+#define OUT
+#define OPTIONAL
+#define CONST     const
+#define STATIC    static
+#define EFIAPI
+
+#define TRUE      ((BOOLEAN)(1==1))
+#define FALSE     ((BOOLEAN)(0==1))
+
+#define BIT0      0x00000001
+#define BIT1      0x00000002
+#define BIT2      0x00000004
+#define BIT3      0x00000008
+#define BIT4      0x00000010
+#define BIT5      0x00000020
+#define BIT6      0x00000040
+#define BIT7      0x00000080
+#define BIT8      0x00000100
+#define BIT9      0x00000200
+#define BIT10     0x00000400
+#define BIT11     0x00000800
+#define BIT12     0x00001000
+#define BIT13     0x00002000
+#define BIT14     0x00004000
+#define BIT15     0x00008000
+#define BIT16     0x00010000
+#define BIT17     0x00020000
+#define BIT18     0x00040000
+#define BIT19     0x00080000
+#define BIT20     0x00100000
+#define BIT21     0x00200000
+#define BIT22     0x00400000
+#define BIT23     0x00800000
+#define BIT24     0x01000000
+#define BIT25     0x02000000
+#define BIT26     0x04000000
+#define BIT27     0x08000000
+#define BIT28     0x10000000
+#define BIT29     0x20000000
+#define BIT30     0x40000000
+#define BIT31     0x80000000
+
+#define MAX_BIT     ((UINTN)1 << (sizeof (UINTN) * 8 - 1))
+#define MAX_UINT32  ((UINT32)0xFFFFFFFF)
+#define MAX_UINT64  ((UINT64)0xFFFFFFFFFFFFFFFFULL)
+#define MAX_INT32   ((INT32)0x7FFFFFFF)
+#define MAX_UINTN   ((UINTN)-1)
+
+#define ENCODE_ERROR(StatusCode)  ((RETURN_STATUS)(MAX_BIT | (StatusCode)))
+#define RETURN_ERROR(StatusCode)  (((INTN)(RETURN_STATUS)(StatusCode)) < 0)
+
+#define SIGNATURE_16(A, B)        ((A) | (B << 8))
+#define SIGNATURE_32(A, B, C, D)  (SIGNATURE_16 (A, B) | (SIGNATURE_16 (C, D) << 16))
+
+#define BASE_CR(Record, TYPE, Field)  ((TYPE *) ((CHAR8 *) (Record) - (CHAR8 *) &(((TYPE *) 0)->Field)))
+#define CR(Record, TYPE, Field, TestSignature)  BASE_CR (Record, TYPE, Field)
+
+#define MIN(a, b)  (((a) < (b)) ? (a) : (b))
+#define MAX(a, b)  (((a) > (b)) ? (a) : (b))
+
+#endif
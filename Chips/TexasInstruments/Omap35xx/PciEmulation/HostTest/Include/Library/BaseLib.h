@@ -0,0 +1,38 @@
+/** @file
+  Host build of the BaseLib functions the PciEmulation sources use.
+
+  This program and the accompanying materials
+  are licensed and made available under the terms and conditions of the BSD License
+  which accompanies this distribution.  The full text of the license may be found at
+  http://opensource.org/licenses/bsd-license.php
+
+  THE PROGRAM IS DISTRIBUTED UNDER THE BSD LICENSE ON AN "AS IS" BASIS,
+  WITHOUT WARRANTIES OR REPRESENTATIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED.
+
+**/
+
+#ifndef __HOST_BASE_LIB_H__
+#define __HOST_BASE_LIB_H__
+
+UINT64
+EFIAPI
+LShiftU64 (
+  IN UINT64  Operand,
+  IN UINTN   Count
+  );
+
+UINT64
+EFIAPI
+MultU64x64 (
+  IN UINT64  Multiplicand,
+  IN UINT64  Multiplier
+  );
+
+UINT64
+EFIAPI
+DivU64x32 (
+  IN UINT64  Dividend,
+  IN UINT32  Divisor
+  );
+
+#endif
@@ -0,0 +1,17 @@
+/** @file
+  Host build of CacheMaintenanceLib. The PciEmulation sources use nothing from it.
+
+  This program and the accompanying materials
+  are licensed and made available under the terms and conditions of the BSD License
+  which accompanies this distribution.  The full text of the license may be found at
+  http://opensource.org/licenses/bsd-license.php
+
+  THE PROGRAM IS DISTRIBUTED UNDER THE BSD LICENSE ON AN "AS IS" BASIS,
+  WITHOUT WARRANTIES OR REPRESENTATIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED.
+
+**/
+
+#ifndef __HOST_CACHE_MAINTENANCE_LIB_H__
+#define __HOST_CACHE_MAINTENANCE_LIB_H__
+
+#endif
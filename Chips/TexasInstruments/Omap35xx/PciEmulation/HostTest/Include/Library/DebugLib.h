@@ -0,0 +1,39 @@
+/** @file
+  Host build of DebugLib. Assertions are counted by the test instead of halting.
+
+  This program and the accompanying materials
+  are licensed and made available under the terms and conditions of the BSD License
+  which accompanies this distribution.  The full text of the license may be found at
+  http://opensource.org/licenses/bsd-license.php
+
+  THE PROGRAM IS DISTRIBUTED UNDER THE BSD LICENSE ON AN "AS IS" BASIS,
+  WITHOUT WARRANTIES OR REPRESENTATIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED.
+
+**/
+
+#ifndef __HOST_DEBUG_LIB_H__
+#define __HOST_DEBUG_LIB_H__
+
+VOID
+EFIAPI
+DebugAssert (
+  IN CONST CHAR8  *FileName,
+  IN UINTN        LineNumber,
+  IN CONST CHAR8  *Description
+  );
+
+#define EFI_D_ERROR   0x80000000
+#define DEBUG_ERROR   0x80000000
+
+#define DEBUG(Expression)
+
+#define ASSERT(Expression)  \
+  do {                      \
+    if (!(Expression)) {    \
+      DebugAssert (__FILE__, __LINE__, #Expression); \
+    }                       \
+  } while (FALSE)
+
+#define ASSERT_EFI_ERROR(StatusParameter)  ASSERT (!EFI_ERROR (StatusParameter))
+
+#endif
@@ -0,0 +1,50 @@
+/** @file
+  Host build of the IoLib functions the PciEmulation sources use.
+
+  This program and the accompanying materials
+  are licensed and made available under the terms and conditions of the BSD License
+  which accompanies this distribution.  The full text of the license may be found at
+  http://opensource.org/licenses/bsd-license.php
+
+  THE PROGRAM IS DISTRIBUTED UNDER THE BSD LICENSE ON AN "AS IS" BASIS,
+  WITHOUT WARRANTIES OR REPRESENTATIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED.
+
+**/
+
+#ifndef __HOST_IO_LIB_H__
+#define __HOST_IO_LIB_H__
+
+UINT8
+EFIAPI
+MmioRead8 (
+  IN UINTN  Address
+  );
+
+UINT32
+EFIAPI
+MmioRead32 (
+  IN UINTN  Address
+  );
+
+UINT32
+EFIAPI
+MmioWrite32 (
+  IN UINTN   Address,
+  IN UINT32  Value
+  );
+
+UINT32
+EFIAPI
+MmioOr32 (
+  IN UINTN   Address,
+  IN UINT32  OrData
+  );
+
+UINT32
+EFIAPI
+MmioAnd32 (
+  IN UINTN   Address,
+  IN UINT32  AndData
+  );
+
+#endif
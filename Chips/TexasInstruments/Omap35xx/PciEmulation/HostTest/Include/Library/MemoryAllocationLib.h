@@ -0,0 +1,35 @@
+/** @file
+  Host build of the MemoryAllocationLib functions the PciEmulation sources use.
+
+  This program and the accompanying materials
+  are licensed and made available under the terms and conditions of the BSD License
+  which accompanies this distribution.  The full text of the license may be found at
+  http://opensource.org/licenses/bsd-license.php
+
+  THE PROGRAM IS DISTRIBUTED UNDER THE BSD LICENSE ON AN "AS IS" BASIS,
+  WITHOUT WARRANTIES OR REPRESENTATIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED.
+
+**/
+
+#ifndef __HOST_MEMORY_ALLOCATION_LIB_H__
+#define __HOST_MEMORY_ALLOCATION_LIB_H__
+
+VOID *
+EFIAPI
+AllocatePool (
+  IN UINTN  AllocationSize
+  );
+
+VOID *
+EFIAPI
+AllocateZeroPool (
+  IN UINTN  AllocationSize
+  );
+
+VOID
+EFIAPI
+FreePool (
+  IN VOID   *Buffer
+  );
+
+#endif
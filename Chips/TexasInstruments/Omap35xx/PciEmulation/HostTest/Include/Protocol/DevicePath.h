@@ -0,0 +1,50 @@
+/** @file
+  Host build of the device path nodes the PciEmulation sources use.
+
+  This program and the accompanying materials
+  are licensed and made available under the terms and conditions of the BSD License
+  which accompanies this distribution.  The full text of the license may be found at
+  http://opensource.org/licenses/bsd-license.php
+
+  THE PROGRAM IS DISTRIBUTED UNDER THE BSD LICENSE ON AN "AS IS" BASIS,
+  WITHOUT WARRANTIES OR REPRESENTATIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED.
+
+**/
+
+#ifndef __HOST_DEVICE_PATH_H__
+#define __HOST_DEVICE_PATH_H__
+
+typedef struct {
+  UINT8 Type;
+  UINT8 SubType;
+  UINT8 Length[2];
+} EFI_DEVICE_PATH_PROTOCOL;
+
+#define HARDWARE_DEVICE_PATH      0x01
+#define HW_PCI_DP                 0x01
+
+typedef struct {
+  EFI_DEVICE_PATH_PROTOCOL  Header;
+  UINT8                     Function;
+  UINT8                     Device;
+} PCI_DEVICE_PATH;
+
+#define ACPI_DEVICE_PATH          0x02
+#define ACPI_DP                   0x01
+
+typedef struct {
+  EFI_DEVICE_PATH_PROTOCOL  Header;
+  UINT32                    HID;
+  UINT32                    UID;
+} ACPI_HID_DEVICE_PATH;
+
+#define PNP_EISA_ID_CONST         0x41d0
+#define EISA_ID(_Name, _Num)      ((UINT32)((_Name) | (_Num) << 16))
+#define EISA_PNP_ID(_PNPId)       (EISA_ID(PNP_EISA_ID_CONST, (_PNPId)))
+
+#define END_DEVICE_PATH_TYPE                 0x7f
+#define END_ENTIRE_DEVICE_PATH_SUBTYPE       0xFF
+
+extern EFI_GUID gEfiDevicePathProtocolGuid;
+
+#endif
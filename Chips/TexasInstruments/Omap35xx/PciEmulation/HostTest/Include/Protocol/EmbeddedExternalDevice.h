@@ -0,0 +1,44 @@
+/** @file
+  Host build of the EmbeddedExternalDevice protocol.
+
+  This program and the accompanying materials
+  are licensed and made available under the terms and conditions of the BSD License
+  which accompanies this distribution.  The full text of the license may be found at
+  http://opensource.org/licenses/bsd-license.php
+
+  THE PROGRAM IS DISTRIBUTED UNDER THE BSD LICENSE ON AN "AS IS" BASIS,
+  WITHOUT WARRANTIES OR REPRESENTATIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED.
+
+**/
+
+#ifndef __HOST_EMBEDDED_EXTERNAL_DEVICE_H__
+#define __HOST_EMBEDDED_EXTERNAL_DEVICE_H__
+
+typedef struct _EMBEDDED_EXTERNAL_DEVICE EMBEDDED_EXTERNAL_DEVICE;
+
+typedef
+EFI_STATUS
+(EFIAPI *EMBEDDED_EXTERNAL_DEVICE_READ) (
+  IN  EMBEDDED_EXTERNAL_DEVICE  *This,
+  IN  UINTN                     Register,
+  IN  UINTN                     Length,
+  OUT VOID                      *Buffer
+  );
+
+typedef
+EFI_STATUS
+(EFIAPI *EMBEDDED_EXTERNAL_DEVICE_WRITE) (
+  IN EMBEDDED_EXTERNAL_DEVICE   *This,
+  IN UINTN                      Register,
+  IN UINTN                      Length,
+  IN VOID                       *Buffer
+  );
+
+struct _EMBEDDED_EXTERNAL_DEVICE {
+  EMBEDDED_EXTERNAL_DEVICE_READ   Read;
+  EMBEDDED_EXTERNAL_DEVICE_WRITE  Write;
+};
+
+extern EFI_GUID gEmbeddedExternalDeviceProtocolGuid;
+
+#endif
@@ -0,0 +1,76 @@
+/** @file
+  Host build of the UEFI definitions the PciEmulation sources use.
+
+  This program and the accompanying materials
+  are licensed and made available under the terms and conditions of the BSD License
+  which accompanies this distribution.  The full text of the license may be found at
+  http://opensource.org/licenses/bsd-license.php
+
+  THE PROGRAM IS DISTRIBUTED UNDER THE BSD LICENSE ON AN "AS IS" BASIS,
+  WITHOUT WARRANTIES OR REPRESENTATIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED.
+
+**/
+
+#ifndef __HOST_UEFI_H__
+#define __HOST_UEFI_H__
+
+#include <Base.h>
+
+typedef RETURN_STATUS         EFI_STATUS;
+typedef VOID                  *EFI_HANDLE;
+typedef VOID                  *EFI_EVENT;
+typedef UINTN                 EFI_TPL;
+typedef GUID                  EFI_GUID;
+typedef UINT64                EFI_PHYSICAL_ADDRESS;
+
+#define EFI_SUCCESS               0
+#define EFI_INVALID_PARAMETER     ENCODE_ERROR (2)
+#define EFI_UNSUPPORTED           ENCODE_ERROR (3)
+#define EFI_DEVICE_ERROR          ENCODE_ERROR (7)
+#define EFI_OUT_OF_RESOURCES      ENCODE_ERROR (9)
+#define EFI_NOT_FOUND             ENCODE_ERROR (14)
+#define EFI_TIMEOUT               ENCODE_ERROR (18)
+#define EFI_ERROR(A)              RETURN_ERROR (A)
+
+#define EFI_PAGE_SIZE             0x1000
+#define EFI_PAGE_MASK             0xFFF
+#define EFI_PAGE_SHIFT            12
+#define EFI_SIZE_TO_PAGES(Size)   (((Size) >> EFI_PAGE_SHIFT) + (((Size) & EFI_PAGE_MASK) ? 1 : 0))
+#define EFI_PAGES_TO_SIZE(Pages)  ((UINTN)(Pages) << EFI_PAGE_SHIFT)
+
+#define TPL_APPLICATION       4
+#define TPL_CALLBACK          8
+#define TPL_NOTIFY            16
+#define TPL_HIGH_LEVEL        31
+
+typedef enum {
+  AllocateAnyPages,
+  AllocateMaxAddress,
+  AllocateAddress,
+  MaxAllocateType
+} EFI_ALLOCATE_TYPE;
+
+typedef enum {
+  EfiReservedMemoryType,
+  EfiLoaderCode,
+  EfiLoaderData,
+  EfiBootServicesCode,
+  EfiBootServicesData,
+  EfiRuntimeServicesCode,
+  EfiRuntimeServicesData,
+  EfiConventionalMemory,
+  EfiMaxMemoryType
+} EFI_MEMORY_TYPE;
+
+#include <Protocol/DevicePath.h>
+
+typedef struct {
+  EFI_STATUS  (EFIAPI *LocateProtocol) (EFI_GUID *Protocol, VOID *Registration, VOID **Interface);
+  EFI_STATUS  (EFIAPI *InstallMultipleProtocolInterfaces) (EFI_HANDLE *Handle, ...);
+} EFI_BOOT_SERVICES;
+
+typedef struct {
+  EFI_BOOT_SERVICES  *BootServices;
+} EFI_SYSTEM_TABLE;
+
+#endif
@@ -0,0 +1,573 @@
+/** @file
+  Register model tests of the PciEmulation PollMem, PollIo and CopyMem services.
+
+  The emulation sources are included as they are. The BAR of the emulated
+  controller is a page of host memory below 4GB, and the performance counter
+  is a model that only moves when the code under test waits, so the timing
+  of the polls is exact and the tests do not depend on the host.
+
+  This program and the accompanying materials
+  are licensed and made available under the terms and conditions of the BSD License
+  which accompanies this distribution.  The full text of the license may be found at
+  http://opensource.org/licenses/bsd-license.php
+
+  THE PROGRAM IS DISTRIBUTED UNDER THE BSD LICENSE ON AN "AS IS" BASIS,
+  WITHOUT WARRANTIES OR REPRESENTATIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED.
+
+**/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+
+#include "../PciEmulation.c"
+#include "../PciRootBridgeIo.c"
+
+#define TEST_COUNTER_FREQUENCY    13000000    // SYS_CLK of the BeagleBoard
+#define TEST_BAR_SIZE             0x80
+#define TEST_STATUS_REGISTER      0x14
+#define TEST_COPY_ITERATIONS      100000
+
+EFI_BOOT_SERVICES *gBS = NULL;
+
+EFI_GUID gEfiDevicePathProtocolGuid;
+EFI_GUID gEfiPciIoProtocolGuid;
+EFI_GUID gEfiPciRootBridgeIoProtocolGuid;
+EFI_GUID gEmbeddedExternalDeviceProtocolGuid;
+
+STATIC UINTN  mFailures = 0;
+STATIC UINTN  mAssertions = 0;
+
+//
+// Performance counter model. It counts from 0 to mCounterEnd and only moves
+// in MicroSecondDelay.
+//
+STATIC UINT64 mCounter;
+STATIC UINT64 mCounterEnd;
+STATIC UINT64 mDelayedUs;
+
+//
+// Register model. The device sets the status register to mStatusAfter once
+// mStatusAfterUs microseconds have been waited, 0 never changes it.
+//
+STATIC UINT8  *mBar;
+STATIC UINT32 mStatusAfter;
+STATIC UINT64 mStatusAfterUs;
+STATIC UINTN  mStatusReads;
+
+STATIC EFI_PCI_IO_PRIVATE_DATA  mPrivate;
+STATIC PCI_TYPE00               mConfigSpace;
+
+#define CHECK(Expression)                                                   \
+  do {                                                                      \
+    if (!(Expression)) {                                                    \
+      printf ("%s:%d: check failed: %s\n", __FILE__, __LINE__, #Expression); \
+      mFailures++;                                                          \
+    }                                                                       \
+  } while (FALSE)
+
+VOID
+EFIAPI
+DebugAssert (
+  IN CONST CHAR8  *FileName,
+  IN UINTN        LineNumber,
+  IN CONST CHAR8  *Description
+  )
+{
+  mAssertions++;
+}
+
+UINTN
+EFIAPI
+MicroSecondDelay (
+  IN UINTN  MicroSeconds
+  )
+{
+  UINT64  Ticks;
+
+  Ticks = (UINT64)MicroSeconds * (TEST_COUNTER_FREQUENCY / 1000000);
+  if (mCounterEnd - mCounter < Ticks) {
+    mCounter = Ticks - (mCounterEnd - mCounter) - 1;
+  } else {
+    mCounter += Ticks;
+  }
+
+  mDelayedUs += MicroSeconds;
+  if ((mStatusAfterUs != 0) && (mDelayedUs >= mStatusAfterUs)) {
+    *(volatile UINT32 *)(mBar + TEST_STATUS_REGISTER) = mStatusAfter;
+  }
+
+  return MicroSeconds;
+}
+
+UINT64
+EFIAPI
+GetPerformanceCounter (
+  VOID
+  )
+{
+  return mCounter;
+}
+
+UINT64
+EFIAPI
+GetPerformanceCounterProperties (
+  OUT UINT64  *StartValue,  OPTIONAL
+  OUT UINT64  *EndValue     OPTIONAL
+  )
+{
+  if (StartValue != NULL) {
+    *StartValue = 0;
+  }
+  if (EndValue != NULL) {
+    *EndValue = mCounterEnd;
+  }
+  return TEST_COUNTER_FREQUENCY;
+}
+
+UINT64
+EFIAPI
+LShiftU64 (
+  IN UINT64  Operand,
+  IN UINTN   Count
+  )
+{
+  return Operand << Count;
+}
+
+UINT64
+EFIAPI
+MultU64x64 (
+  IN UINT64  Multiplicand,
+  IN UINT64  Multiplier
+  )
+{
+  return Multiplicand * Multiplier;
+}
+
+UINT64
+EFIAPI
+DivU64x32 (
+  IN UINT64  Dividend,
+  IN UINT32  Divisor
+  )
+{
+  return Dividend / Divisor;
+}
+
+VOID *
+EFIAPI
+CopyMem (
+  OUT VOID       *DestinationBuffer,
+  IN CONST VOID  *SourceBuffer,
+  IN UINTN       Length
+  )
+{
+  return memmove (DestinationBuffer, SourceBuffer, Length);
+}
+
+VOID *
+EFIAPI
+AllocatePool (
+  IN UINTN  AllocationSize
+  )
+{
+  return malloc (AllocationSize);
+}
+
+VOID *
+EFIAPI
+AllocateZeroPool (
+  IN UINTN  AllocationSize
+  )
+{
+  return calloc (1, AllocationSize);
+}
+
+VOID
+EFIAPI
+FreePool (
+  IN VOID   *Buffer
+  )
+{
+  free (Buffer);
+}
+
+UINT8
+EFIAPI
+MmioRead8 (
+  IN UINTN  Address
+  )
+{
+  return *(volatile UINT8 *)Address;
+}
+
+UINT32
+EFIAPI
+MmioRead32 (
+  IN UINTN  Address
+  )
+{
+  return *(volatile UINT32 *)Address;
+}
+
+UINT32
+EFIAPI
+MmioWrite32 (
+  IN UINTN   Address,
+  IN UINT32  Value
+  )
+{
+  return *(volatile UINT32 *)Address = Value;
+}
+
+UINT32
+EFIAPI
+MmioOr32 (
+  IN UINTN   Address,
+  IN UINT32  OrData
+  )
+{
+  return MmioWrite32 (Address, MmioRead32 (Address) | OrData);
+}
+
+UINT32
+EFIAPI
+MmioAnd32 (
+  IN UINTN   Address,
+  IN UINT32  AndData
+  )
+{
+  return MmioWrite32 (Address, MmioRead32 (Address) & AndData);
+}
+
+//
+// The tests do not map buffers, DmaLib and the DMA pool are not built in
+//
+EFI_STATUS
+EFIAPI
+DmaMap (
+  IN     DMA_MAP_OPERATION              Operation,
+  IN     VOID                           *HostAddress,
+  IN OUT UINTN                          *NumberOfBytes,
+  OUT    EFI_PHYSICAL_ADDRESS           *DeviceAddress,
+  OUT    VOID                           **Mapping
+  )
+{
+  return EFI_UNSUPPORTED;
+}
+
+EFI_STATUS
+EFIAPI
+DmaUnmap (
+  IN  VOID                         *Mapping
+  )
+{
+  return EFI_UNSUPPORTED;
+}
+
+EFI_STATUS
+EFIAPI
+DmaAllocateBuffer (
+  IN  EFI_MEMORY_TYPE              MemoryType,
+  IN  UINTN                        Pages,
+  OUT VOID                         **HostAddress
+  )
+{
+  return EFI_UNSUPPORTED;
+}
+
+EFI_STATUS
+EFIAPI
+DmaFreeBuffer (
+  IN  UINTN                        Pages,
+  IN  VOID                         *HostAddress
+  )
+{
+  return EFI_UNSUPPORTED;
+}
+
+EFI_STATUS
+PciDmaPoolInitialize (
+  IN OUT PCI_DMA_POOL  *Pool
+  )
+{
+  return EFI_UNSUPPORTED;
+}
+
+EFI_STATUS
+PciDmaPoolAllocateBuffer (
+  IN  PCI_DMA_POOL     *Pool,
+  IN  EFI_MEMORY_TYPE  MemoryType,
+  IN  UINTN            Pages,
+  OUT VOID             **HostAddress
+  )
+{
+  return EFI_UNSUPPORTED;
+}
+
+EFI_STATUS
+PciDmaPoolFreeBuffer (
+  IN  PCI_DMA_POOL  *Pool,
+  IN  UINTN         Pages,
+  IN  VOID          *HostAddress
+  )
+{
+  return EFI_NOT_FOUND;
+}
+
+EFI_STATUS
+PciDmaPoolMap (
+  IN     PCI_DMA_POOL                   *Pool,
+  IN     EFI_PCI_IO_PROTOCOL_OPERATION  Operation,
+  IN     VOID                           *HostAddress,
+  IN OUT UINTN                          *NumberOfBytes,
+  OUT    EFI_PHYSICAL_ADDRESS           *DeviceAddress,
+  OUT    VOID                           **Mapping
+  )
+{
+  return EFI_UNSUPPORTED;
+}
+
+EFI_STATUS
+PciDmaPoolUnmap (
+  IN  PCI_DMA_POOL  *Pool,
+  IN  VOID          *Mapping
+  )
+{
+  return EFI_NOT_FOUND;
+}
+
+/**
+  Set up the emulated controller the way PciEmulationEntryPoint does, with its
+  BAR on a page of host memory.
+
+**/
+STATIC
+VOID
+TestInitializeDevice (
+  VOID
+  )
+{
+  mBar = mmap (NULL, EFI_PAGE_SIZE, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_32BIT, -1, 0);
+  if (mBar == MAP_FAILED) {
+    printf ("No memory below 4GB for the BAR\n");
+    exit (1);
+  }
+
+  mPrivate.Signature              = EFI_PCI_IO_PRIVATE_DATA_SIGNATURE;
+  mPrivate.RootBridge.Signature   = PCI_ROOT_BRIDGE_SIGNATURE;
+  mPrivate.RootBridge.MemoryStart = (UINT32)(UINTN)mBar;
+  mPrivate.RootBridge.MemorySize  = TEST_BAR_SIZE;
+  mPrivate.ConfigSpace            = &mConfigSpace;
+  mConfigSpace.Device.Bar[0]      = (UINT32)(UINTN)mBar;
+  CopyMem (&mPrivate.PciIoProtocol, &PciIoTemplate, sizeof (PciIoTemplate));
+}
+
+/**
+  Start a poll with the status register at Initial, changing to After once
+  AfterUs microseconds have been waited, and the counter at Counter.
+
+**/
+STATIC
+VOID
+TestResetModel (
+  IN UINT64  CounterEnd,
+  IN UINT64  Counter,
+  IN UINT32  Initial,
+  IN UINT32  After,
+  IN UINT64  AfterUs
+  )
+{
+  mCounterEnd = CounterEnd;
+  mCounter = Counter;
+  mDelayedUs = 0;
+  *(volatile UINT32 *)(mBar + TEST_STATUS_REGISTER) = Initial;
+  mStatusAfter = After;
+  mStatusAfterUs = AfterUs;
+  mStatusReads = 0;
+}
+
+STATIC
+VOID
+TestPollMem (
+  VOID
+  )
+{
+  EFI_PCI_IO_PROTOCOL *PciIo = &mPrivate.PciIoProtocol;
+  EFI_STATUS          Status;
+  UINT64              Result;
+  UINTN               Index;
+  UINT64              CounterEnds[] = { MAX_UINT32, MAX_UINT64 };
+
+  // Already in the requested state, no wait
+  TestResetModel (MAX_UINT32, 0, BIT0, 0, 0);
+  Status = PciIo->PollMem (PciIo, EfiPciIoWidthUint32, 0, TEST_STATUS_REGISTER, BIT0, BIT0, 10000, &Result);
+  CHECK (Status == EFI_SUCCESS);
+  CHECK (Result == BIT0);
+  CHECK (mDelayedUs == 0);
+
+  // A Delay of 0 reads once and returns the value, even if it does not match
+  TestResetModel (MAX_UINT32, 0, 0x1234, BIT0, 1);
+  Status = PciIo->PollMem (PciIo, EfiPciIoWidthUint32, 0, TEST_STATUS_REGISTER, BIT0, BIT0, 0, &Result);
+  CHECK (Status == EFI_SUCCESS);
+  CHECK (Result == 0x1234);
+  CHECK (mDelayedUs == 0);
+
+  for (Index = 0; Index < sizeof (CounterEnds) / sizeof (CounterEnds[0]); Index++) {
+    // The device sets the bit after 500us, the poll of 10ms sees it within
+    // one poll interval. The counter wraps during the poll.
+    TestResetModel (CounterEnds[Index], CounterEnds[Index] - 1000, 0, BIT31 | BIT0, 500);
+    Status = PciIo->PollMem (PciIo, EfiPciIoWidthUint32, 0, TEST_STATUS_REGISTER, BIT31, BIT31, 100000, &Result);
+    CHECK (Status == EFI_SUCCESS);
+    CHECK (Result == (BIT31 | BIT0));
+    CHECK ((mDelayedUs >= 500) && (mDelayedUs < 500 + PCI_IO_POLL_MAX_INTERVAL_US));
+
+    // The bit never comes, the poll of 1ms ends within one interval after it
+    TestResetModel (CounterEnds[Index], CounterEnds[Index] - 1000, 0, 0, 0);
+    Status = PciIo->PollMem (PciIo, EfiPciIoWidthUint32, 0, TEST_STATUS_REGISTER, BIT0, BIT0, 10000, &Result);
+    CHECK (Status == EFI_TIMEOUT);
+    CHECK (Result == 0);
+    CHECK ((mDelayedUs >= 1000) && (mDelayedUs <= 1000 + PCI_IO_POLL_MAX_INTERVAL_US));
+  }
+
+  // The longest Delay does not overflow the deadline
+  TestResetModel (MAX_UINT64, 0, 0, BIT0, 2000);
+  Status = PciIo->PollMem (PciIo, EfiPciIoWidthUint32, 0, TEST_STATUS_REGISTER, BIT0, BIT0, MAX_UINT64, &Result);
+  CHECK (Status == EFI_SUCCESS);
+  CHECK ((mDelayedUs >= 2000) && (mDelayedUs < 2000 + PCI_IO_POLL_MAX_INTERVAL_US));
+
+  // Narrow widths only compare and return the bytes they read
+  TestResetModel (MAX_UINT32, 0, 0xAABBCCDD, 0, 0);
+  Status = PciIo->PollMem (PciIo, EfiPciIoWidthUint8, 0, TEST_STATUS_REGISTER, 0xFF, 0xDD, 10, &Result);
+  CHECK ((Status == EFI_SUCCESS) && (Result == 0xDD));
+  Status = PciIo->PollMem (PciIo, EfiPciIoWidthUint16, 0, TEST_STATUS_REGISTER, 0xFFFF, 0xCCDD, 10, &Result);
+  CHECK ((Status == EFI_SUCCESS) && (Result == 0xCCDD));
+  Status = PciIo->PollMem (PciIo, EfiPciIoWidthUint64, 0, TEST_STATUS_REGISTER - 4, MAX_UINT64, 0xAABBCCDD00000000ULL, 10, &Result);
+  CHECK (Status == EFI_SUCCESS);
+
+  // Bad parameters
+  TestResetModel (MAX_UINT32, 0, 0, 0, 0);
+  Status = PciIo->PollMem (PciIo, EfiPciIoWidthUint32, 0, TEST_STATUS_REGISTER, BIT0, BIT0, 10, NULL);
+  CHECK (Status == EFI_INVALID_PARAMETER);
+  Status = PciIo->PollMem (PciIo, EfiPciIoWidthMaximum, 0, TEST_STATUS_REGISTER, BIT0, BIT0, 10, &Result);
+  CHECK (Status == EFI_INVALID_PARAMETER);
+  Status = PciIo->PollMem (PciIo, EfiPciIoWidthUint32, 0, TEST_BAR_SIZE, BIT0, BIT0, 10, &Result);
+  CHECK (Status == EFI_INVALID_PARAMETER);
+  Status = PciIo->PollMem (PciIo, EfiPciIoWidthUint32, 0, TEST_STATUS_REGISTER + 1, BIT0, BIT0, 10, &Result);
+  CHECK (Status == EFI_INVALID_PARAMETER);
+  CHECK (mDelayedUs == 0);
+}
+
+STATIC
+VOID
+TestPollIo (
+  VOID
+  )
+{
+  EFI_PCI_IO_PROTOCOL *PciIo = &mPrivate.PciIoProtocol;
+  EFI_STATUS          Status;
+  UINT64              Result;
+  UINTN               Assertions;
+
+  // The emulated controller has no I/O space, the read fails and ends the poll
+  Assertions = mAssertions;
+  TestResetModel (MAX_UINT32, 0, 0, 0, 0);
+  Status = PciIo->PollIo (PciIo, EfiPciIoWidthUint32, 0, 0, BIT0, BIT0, 10000, &Result);
+  CHECK (Status == EFI_UNSUPPORTED);
+  CHECK (mDelayedUs == 0);
+  CHECK (mAssertions == Assertions + 1);
+}
+
+STATIC
+VOID
+TestCopyMem (
+  VOID
+  )
+{
+  EFI_PCI_IO_PROTOCOL *PciIo = &mPrivate.PciIoProtocol;
+  EFI_STATUS          Status;
+  UINT8               Before[TEST_BAR_SIZE];
+  UINT8               Expected[TEST_BAR_SIZE];
+  UINTN               Iteration;
+  UINTN               Index;
+  UINTN               Width;
+  UINTN               Stride;
+  UINT64              Destination;
+  UINT64              Source;
+  UINTN               Count;
+  BOOLEAN             Valid;
+  UINTN               Rejected = 0;
+  UINTN               Failures = mFailures;
+
+  srand (1);
+
+  for (Iteration = 0; Iteration < TEST_COPY_ITERATIONS; Iteration++) {
+    Width = rand () % 4;
+    Stride = (UINTN)1 << Width;
+
+    // Mostly aligned offsets inside the BAR, some arbitrary ones around its end
+    Destination = (rand () % 8) ? (rand () % (TEST_BAR_SIZE / Stride)) * Stride : rand () % (TEST_BAR_SIZE + 8);
+    Source = (rand () % 8) ? (rand () % (TEST_BAR_SIZE / Stride)) * Stride : rand () % (TEST_BAR_SIZE + 8);
+    Count = rand () % ((TEST_BAR_SIZE - (MAX (Destination, Source) % TEST_BAR_SIZE)) / Stride + 2);
+
+    for (Index = 0; Index < TEST_BAR_SIZE; Index++) {
+      Before[Index] = mBar[Index] = (UINT8)rand ();
+    }
+
+    Valid = (Count == 0) ||
+            (((Destination % Stride) == 0) && ((Source % Stride) == 0) &&
+             (Destination + Count * Stride <= TEST_BAR_SIZE) && (Source + Count * Stride <= TEST_BAR_SIZE));
+
+    memcpy (Expected, Before, TEST_BAR_SIZE);
+    if (Valid) {
+      memmove (Expected + Destination, Before + Source, Count * Stride);
+    } else {
+      Rejected++;
+    }
+
+    Status = PciIo->CopyMem (PciIo, (EFI_PCI_IO_PROTOCOL_WIDTH)Width, 0, Destination, 0, Source, Count);
+    CHECK (Status == (Valid ? EFI_SUCCESS : EFI_INVALID_PARAMETER));
+    CHECK (memcmp (Expected, mBar, TEST_BAR_SIZE) == 0);
+    if (mFailures != Failures) {
+      printf ("Width %d Destination 0x%llx Source 0x%llx Count %d\n",
+              (int)Width, (unsigned long long)Destination, (unsigned long long)Source, (int)Count);
+      return;
+    }
+  }
+
+  // Some of the random copies have to exercise the checks
+  CHECK ((Rejected > 0) && (Rejected < TEST_COPY_ITERATIONS / 4));
+
+  // Only plain widths copy, and only BAR 0 exists
+  Status = PciIo->CopyMem (PciIo, EfiPciIoWidthFifoUint8, 0, 0, 0, 8, 4);
+  CHECK (Status == EFI_INVALID_PARAMETER);
+  Status = PciIo->CopyMem (PciIo, EfiPciIoWidthFillUint32, 0, 0, 0, 8, 4);
+  CHECK (Status == EFI_INVALID_PARAMETER);
+  Status = PciIo->CopyMem (PciIo, EfiPciIoWidthUint8, 1, 0, 0, 8, 4);
+  CHECK (Status == EFI_UNSUPPORTED);
+  Status = PciIo->CopyMem (PciIo, EfiPciIoWidthUint8, 0, 0, 1, 8, 4);
+  CHECK (Status == EFI_UNSUPPORTED);
+}
+
+int
+main (
+  int   argc,
+  char  **argv
+  )
+{
+  TestInitializeDevice ();
+
+  TestPollMem ();
+  TestPollIo ();
+  TestCopyMem ();
+
+  if (mFailures != 0) {
+    printf ("PciEmulation host test: %d checks failed\n", (int)mFailures);
+    return 1;
+  }
+
+  printf ("PciEmulation host test: all checks passed\n");
+  return 0;
+}
@@ -0,0 +1,278 @@
+/** @file
+  Coherent DMA pool of the emulated EHCI PCI device.
+
+  The EHCI driver allocates its common buffers (frame list, QH and TD pools)
+  once and maps them again for every transfer. Serving them from a set of
+  uncached pages taken at start up makes those mappings free: nothing has to
+  be tracked and no cache maintenance is needed. Streaming buffers outside
+  the pool are cleaned or invalidated over their own range only, and are
+  left to DmaMap when the cache lines they share with other data would need
+  a bounce buffer.
+
+  This program and the accompanying materials
+  are licensed and made available under the terms and conditions of the BSD License
+  which accompanies this distribution.  The full text of the license may be found at
+  http://opensource.org/licenses/bsd-license.php
+
+  THE PROGRAM IS DISTRIBUTED UNDER THE BSD LICENSE ON AN "AS IS" BASIS,
+  WITHOUT WARRANTIES OR REPRESENTATIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED.
+
+**/
+
+#include "PciEmulation.h"
+
+STATIC
+BOOLEAN
+PciDmaPoolContains (
+  IN PCI_DMA_POOL  *Pool,
+  IN VOID          *HostAddress,
+  IN UINTN         NumberOfBytes
+  )
+{
+  UINTN  Start;
+  UINTN  PoolStart;
+
+  if (Pool->Base == NULL) {
+    return FALSE;
+  }
+
+  Start = (UINTN)HostAddress;
+  PoolStart = (UINTN)Pool->Base;
+
+  return ((Start >= PoolStart) && (NumberOfBytes <= EFI_PAGES_TO_SIZE (Pool->Pages)) &&
+          (Start - PoolStart <= EFI_PAGES_TO_SIZE (Pool->Pages) - NumberOfBytes));
+}
+
+STATIC
+BOOLEAN
+PciDmaPoolPageUsed (
+  IN PCI_DMA_POOL  *Pool,
+  IN UINTN         Page
+  )
+{
+  return ((Pool->Bitmap[Page / 32] & (1u << (Page % 32))) != 0);
+}
+
+STATIC
+VOID
+PciDmaPoolSetPages (
+  IN PCI_DMA_POOL  *Pool,
+  IN UINTN         FirstPage,
+  IN UINTN         Pages,
+  IN BOOLEAN       Used
+  )
+{
+  UINTN  Page;
+
+  for (Page = FirstPage; Page < FirstPage + Pages; Page++) {
+    if (Used) {
+      Pool->Bitmap[Page / 32] |= (1u << (Page % 32));
+    } else {
+      Pool->Bitmap[Page / 32] &= ~(1u << (Page % 32));
+    }
+  }
+}
+
+EFI_STATUS
+PciDmaPoolInitialize (
+  IN OUT PCI_DMA_POOL  *Pool
+  )
+{
+  EFI_STATUS  Status;
+  VOID        *Base;
+
+  ZeroMem (Pool, sizeof (PCI_DMA_POOL));
+
+  if (PcdGet32 (PcdOmap35xxPciDmaPoolPages) == 0) {
+    return EFI_SUCCESS;
+  }
+
+  Pool->Bitmap = AllocateZeroPool ((PcdGet32 (PcdOmap35xxPciDmaPoolPages) + 31) / 32 * sizeof (UINT32));
+  if (Pool->Bitmap == NULL) {
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  Status = DmaAllocateBuffer (EfiBootServicesData, PcdGet32 (PcdOmap35xxPciDmaPoolPages), &Base);
+  if (EFI_ERROR (Status)) {
+    FreePool (Pool->Bitmap);
+    Pool->Bitmap = NULL;
+    return Status;
+  }
+
+  Pool->Base = Base;
+  Pool->Pages = PcdGet32 (PcdOmap35xxPciDmaPoolPages);
+
+  return EFI_SUCCESS;
+}
+
+//Returns EFI_OUT_OF_RESOURCES when the buffer has to come from DmaAllocateBuffer.
+EFI_STATUS
+PciDmaPoolAllocateBuffer (
+  IN  PCI_DMA_POOL     *Pool,
+  IN  EFI_MEMORY_TYPE  MemoryType,
+  IN  UINTN            Pages,
+  OUT VOID             **HostAddress
+  )
+{
+  EFI_TPL  OldTpl;
+  UINTN    FirstPage;
+  UINTN    Free;
+  UINTN    Page;
+
+  // The pool is boot services memory, runtime buffers must be separate pages
+  if ((Pool->Base == NULL) || (MemoryType != EfiBootServicesData) || (Pages == 0) || (Pages > Pool->Pages)) {
+    return EFI_OUT_OF_RESOURCES;
+  }
+
+  OldTpl = gBS->RaiseTPL (TPL_HIGH_LEVEL);
+
+  // First fit
+  Free = 0;
+  FirstPage = 0;
+  for (Page = 0; Page < Pool->Pages; Page++) {
+    if (PciDmaPoolPageUsed (Pool, Page)) {
+      Free = 0;
+      FirstPage = Page + 1;
+    } else if (++Free == Pages) {
+      PciDmaPoolSetPages (Pool, FirstPage, Pages, TRUE);
+      gBS->RestoreTPL (OldTpl);
+
+      *HostAddress = Pool->Base + EFI_PAGES_TO_SIZE (FirstPage);
+      return EFI_SUCCESS;
+    }
+  }
+
+  gBS->RestoreTPL (OldTpl);
+  return EFI_OUT_OF_RESOURCES;
+}
+
+//Returns EFI_NOT_FOUND when the buffer does not belong to the pool.
+EFI_STATUS
+PciDmaPoolFreeBuffer (
+  IN  PCI_DMA_POOL  *Pool,
+  IN  UINTN         Pages,
+  IN  VOID          *HostAddress
+  )
+{
+  EFI_TPL  OldTpl;
+  UINTN    Offset;
+
+  if (!PciDmaPoolContains (Pool, HostAddress, EFI_PAGES_TO_SIZE (Pages))) {
+    return EFI_NOT_FOUND;
+  }
+
+  Offset = (UINT8 *)HostAddress - Pool->Base;
+  if ((Offset & EFI_PAGE_MASK) != 0) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  OldTpl = gBS->RaiseTPL (TPL_HIGH_LEVEL);
+  PciDmaPoolSetPages (Pool, EFI_SIZE_TO_PAGES (Offset), Pages, FALSE);
+  gBS->RestoreTPL (OldTpl);
+
+  return EFI_SUCCESS;
+}
+
+//Returns EFI_UNSUPPORTED when the buffer has to be mapped by DmaMap.
+EFI_STATUS
+PciDmaPoolMap (
+  IN     PCI_DMA_POOL                   *Pool,
+  IN     EFI_PCI_IO_PROTOCOL_OPERATION  Operation,
+  IN     VOID                           *HostAddress,
+  IN OUT UINTN                          *NumberOfBytes,
+  OUT    EFI_PHYSICAL_ADDRESS           *DeviceAddress,
+  OUT    VOID                           **Mapping
+  )
+{
+  PCI_DMA_POOL_MAP  *Map;
+  EFI_TPL           OldTpl;
+  UINTN             LineMask;
+  UINTN             Index;
+
+  if ((HostAddress == NULL) || (NumberOfBytes == NULL) || (DeviceAddress == NULL) || (Mapping == NULL)) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  // Uncached and identity mapped, the device uses the buffer in place
+  if (PciDmaPoolContains (Pool, HostAddress, *NumberOfBytes)) {
+    *DeviceAddress = (EFI_PHYSICAL_ADDRESS)(UINTN)HostAddress;
+    *Mapping = &Pool->PoolMapping;
+    return EFI_SUCCESS;
+  }
+
+  // A common buffer outside the pool is left to the checks of DmaMap
+  if ((Operation != EfiPciIoOperationBusMasterRead) && (Operation != EfiPciIoOperationBusMasterWrite)) {
+    return EFI_UNSUPPORTED;
+  }
+
+  // Invalidating a line the buffer shares with other data would lose that data,
+  // those buffers need the bounce buffer of DmaMap
+  LineMask = ArmDataCacheLineLength () - 1;
+  if ((Operation == EfiPciIoOperationBusMasterWrite) && ((((UINTN)HostAddress | *NumberOfBytes) & LineMask) != 0)) {
+    return EFI_UNSUPPORTED;
+  }
+
+  Map = NULL;
+  OldTpl = gBS->RaiseTPL (TPL_HIGH_LEVEL);
+  for (Index = 0; Index < PCI_DMA_POOL_MAPS; Index++) {
+    if (!Pool->Maps[Index].InUse) {
+      Map = &Pool->Maps[Index];
+      Map->InUse = TRUE;
+      break;
+    }
+  }
+  gBS->RestoreTPL (OldTpl);
+
+  if (Map == NULL) {
+    return EFI_UNSUPPORTED;
+  }
+
+  Map->Operation = Operation;
+  Map->HostAddress = HostAddress;
+  Map->NumberOfBytes = *NumberOfBytes;
+
+  if (Operation == EfiPciIoOperationBusMasterRead) {
+    // The device reads what the CPU wrote
+    WriteBackDataCacheRange (HostAddress, *NumberOfBytes);
+  } else {
+    // No dirty line may be evicted over the data the device writes
+    WriteBackInvalidateDataCacheRange (HostAddress, *NumberOfBytes);
+  }
+
+  *DeviceAddress = (EFI_PHYSICAL_ADDRESS)(UINTN)HostAddress;
+  *Mapping = Map;
+
+  return EFI_SUCCESS;
+}
+
+//Returns EFI_NOT_FOUND when the mapping was made by DmaMap.
+EFI_STATUS
+PciDmaPoolUnmap (
+  IN  PCI_DMA_POOL  *Pool,
+  IN  VOID          *Mapping
+  )
+{
+  PCI_DMA_POOL_MAP  *Map;
+
+  if (Mapping == &Pool->PoolMapping) {
+    return EFI_SUCCESS;
+  }
+
+  if (((UINTN)Mapping < (UINTN)&Pool->Maps[0]) || ((UINTN)Mapping >= (UINTN)&Pool->Maps[PCI_DMA_POOL_MAPS])) {
+    return EFI_NOT_FOUND;
+  }
+
+  Map = (PCI_DMA_POOL_MAP *)Mapping;
+  if (!Map->InUse) {
+    return EFI_INVALID_PARAMETER;
+  }
+
+  // Drop the lines the CPU may have speculatively loaded while the device was writing
+  if (Map->Operation == EfiPciIoOperationBusMasterWrite) {
+    InvalidateDataCacheRange (Map->HostAddress, Map->NumberOfBytes);
+  }
+
+  Map->InUse = FALSE;
+
+  return EFI_SUCCESS;
+}